@@ -60,6 +60,10 @@ function(vulkrt_setup_dependencies)
     endif ()
   endif ()
 
+  if (vulkrt_BUILD_TESTS AND NOT TARGET Catch2::Catch2WithMain)
+    CPMAddPackage("gh:catchorg/Catch2@3.7.1")
+  endif ()
+
   if(NOT TARGET glfw)
     CPMAddPackage(
             NAME glfw
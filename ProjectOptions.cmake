@@ -86,6 +86,8 @@ macro(vulkrt_setup_options)
   endif()
 
   option(vulkrt_BUILD_FUZZ_TESTS "Enable fuzz testing executable" ${DEFAULT_FUZZER})
+  option(vulkrt_BUILD_BENCHMARKS "Enable micro-benchmark executables" OFF)
+  option(vulkrt_BUILD_TESTS "Enable unit test executables" OFF)
 
 endmacro()
 
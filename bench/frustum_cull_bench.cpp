@@ -0,0 +1,56 @@
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/Camera.hpp"
+#include "vulkrt/FrustumCuller.hpp"
+#include "vulkrt/timer/Timer.hpp"
+
+namespace {
+    using lve::FrustumCuller;
+
+    // spheres scattered in a cube around the camera, roughly a fifth of them end up inside the frustum
+    FrustumCuller::SphereBatch randomSpheres(const std::size_t count) {
+        std::mt19937 rng{42};  // NOLINT(*-msc51-cpp)
+        std::uniform_real_distribution<float> position{-100.F, 100.F};
+        std::uniform_real_distribution<float> radius{0.1F, 2.F};
+        FrustumCuller::SphereBatch batch{};
+        batch.reserve(count);
+        for(std::size_t i = 0; i < count; ++i) { batch.push(glm::vec4{position(rng), position(rng), position(rng), radius(rng)}); }
+        return batch;
+    }
+
+    void runSuite(const std::size_t count, const FrustumCuller::Planes &planes) {
+        const auto batch = randomSpheres(count);
+        std::vector<uint32_t> visible(count);
+        std::size_t simdVisible = 0;
+        std::size_t scalarVisible = 0;
+
+        vnd::Timer scalarTimer{FORMAT("{} spheres scalar", count)};
+        const auto scalarTime = scalarTimer.time_it([&] { scalarVisible = FrustumCuller::cullScalar(planes, batch, visible.data()); });
+
+        vnd::Timer simdTimer{FORMAT("{} spheres {}", count, FrustumCuller::isa())};
+        const auto simdTime = simdTimer.time_it([&] { simdVisible = FrustumCuller::cull(planes, batch, visible.data()); });
+
+        if(simdVisible != scalarVisible) [[unlikely]] {
+            throw std::runtime_error(FORMAT("visible count mismatch: {} vs {}", simdVisible, scalarVisible));
+        }
+        LINFO("{} spheres, {} visible", count, simdVisible);
+        LINFO("  scalar : {}", scalarTime);
+        LINFO("  {:<6} : {}", FrustumCuller::isa(), simdTime);
+    }
+}  // namespace
+
+// NOLINTNEXTLINE(bugprone-exception-escape)
+int main() {
+    INIT_LOG()
+    try {
+        lve::Camera camera{};
+        camera.setPerspectiveProjection(glm::radians(50.F), 16.F / 9.F, 0.1F, 100.F);
+        camera.setViewYXZ(glm::vec3{0.F}, glm::vec3{0.F});
+        const auto planes = camera.getFrustumPlanes();
+        for(const std::size_t count : {1'000, 10'000, 100'000, 1'000'000}) { runSuite(count, planes); }
+    } catch(const std::exception &e) {
+        LERROR("{}", e.what());
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+// NOLINTEND(*-include-cleaner)
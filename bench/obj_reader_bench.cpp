@@ -0,0 +1,75 @@
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/ObjReader.hpp"
+#include "vulkrt/Window.hpp"
+#include "vulkrt/timer/Timer.hpp"
+
+namespace {
+    using lve::Model;
+
+    // writes a side x side grid of quads with positions, normals and uvs, ~50 bytes per line
+    fs::path writeSyntheticObj(const std::size_t side) {
+        const auto path = fs::temp_directory_path() / FORMAT("vulkrt_obj_bench_{}.obj", side);
+        std::ofstream out{path, std::ios::binary};
+        out << "vn 0.000000 -1.000000 0.000000\n";
+        for(std::size_t z = 0; z <= side; ++z) {
+            for(std::size_t x = 0; x <= side; ++x) {
+                out << FORMAT("v {:.6f} 0.000000 {:.6f}\nvt {:.6f} {:.6f}\n", C_F(x), C_F(z), C_F(x) / C_F(side), C_F(z) / C_F(side));
+            }
+        }
+        const auto at = [side](std::size_t x, std::size_t z) { return z * (side + 1) + x + 1; };
+        for(std::size_t z = 0; z < side; ++z) {
+            for(std::size_t x = 0; x < side; ++x) {
+                out << FORMAT("f {0}/{0}/1 {1}/{1}/1 {2}/{2}/1 {3}/{3}/1\n", at(x, z), at(x + 1, z), at(x + 1, z + 1), at(x, z + 1));
+            }
+        }
+        return path;
+    }
+
+    void runSuite(const std::string &name, const fs::path &path) {
+        std::size_t uniqueCount = 0;
+        std::size_t indexCount = 0;
+
+        vnd::Timer tinyTimer{FORMAT("{} tinyobj", name)};
+        const auto tinyTime = tinyTimer.time_it([&] {
+            Model::Builder builder{};
+            builder.loadModel(path.string(), Model::ObjLoader::TinyObj);
+        });
+
+        vnd::Timer serialTimer{FORMAT("{} ObjReader serial", name)};
+        const auto serialTime = serialTimer.time_it([&] {
+            std::vector<Model::Vertex> vertices;
+            std::vector<uint32_t> indices;
+            lve::ObjReader::read(path, vertices, indices, {.parallel = false});
+        });
+
+        vnd::Timer parTimer{FORMAT("{} ObjReader parallel", name)};
+        const auto parTime = parTimer.time_it([&] {
+            std::vector<Model::Vertex> vertices;
+            std::vector<uint32_t> indices;
+            lve::ObjReader::read(path, vertices, indices);
+            uniqueCount = vertices.size();
+            indexCount = indices.size();
+        });
+
+        LINFO("{}: {} bytes, {} unique vertices, {} indices", name, fs::file_size(path), uniqueCount, indexCount);
+        LINFO("  tinyobj             : {}", tinyTime);
+        LINFO("  ObjReader serial    : {}", serialTime);
+        LINFO("  ObjReader parallel  : {}", parTime);
+    }
+}  // namespace
+
+// NOLINTNEXTLINE(bugprone-exception-escape)
+int main() {
+    INIT_LOG()
+    try {
+        runSuite("smooth_vase.obj", lve::Window::calculateRelativePathToSrcModels(curentP, "smooth_vase.obj"));
+        const auto synthetic = writeSyntheticObj(1024);
+        runSuite("synthetic 1024x1024 grid", synthetic);
+        fs::remove(synthetic);
+    } catch(const std::exception &e) {
+        LERROR("{}", e.what());
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+// NOLINTEND(*-include-cleaner)
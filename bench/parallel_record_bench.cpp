@@ -0,0 +1,121 @@
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/Descriptors.hpp"
+#include "vulkrt/ParallelRecorder.hpp"
+#include "vulkrt/SimpleRenderSystem.hpp"
+#include "vulkrt/SwapChain.hpp"
+#include "vulkrt/StagingRing.hpp"
+#include "vulkrt/timer/Timer.hpp"
+
+// Records the per-object draws of SimpleRenderSystem into secondary command buffers with 1..N threads and reports the
+// CPU time of one frame's recording. Nothing is submitted, so only the recording cost is measured. Needs a window and a
+// Vulkan device since the secondaries continue the swapchain render pass.
+namespace {
+    using lve::ParallelRecorder;
+
+    struct BenchContext {
+        lve::Device &device;
+        lve::SwapChain &swapChain;
+        lve::DescriptorSetLayout &globalSetLayout;
+        VkDescriptorSet globalSet;
+        VkCommandBuffer primary;
+    };
+
+    // milliseconds per recorded frame, over at least a quarter of a second
+    double recordFrame(const BenchContext &context, lve::SceneStore &scene, std::size_t threadCount) {
+        static constexpr long double MIN_TIME_NS = 250'000'000.0L;
+        const uint32_t framesInFlight = context.swapChain.getFramesInFlight();
+        ParallelRecorder recorder{context.device, framesInFlight, threadCount};
+        lve::SimpleRenderSystem system{context.device, context.swapChain.getRenderPass(),
+                                       context.globalSetLayout.getDescriptorSetLayout(), framesInFlight};
+        lve::Camera camera{};
+        camera.setPerspectiveProjection(glm::radians(50.F), context.swapChain.extentAspectRatio(), 0.1F, 100.F);
+        camera.setViewYXZ(glm::vec3{0.F}, glm::vec3{0.F});
+        const ParallelRecorder::PassInfo pass{.renderPass = context.swapChain.getRenderPass(),
+                                              .framebuffer = context.swapChain.getFrameBuffer(0),
+                                              .extent = context.swapChain.getSwapChainExtent()};
+        const VkRenderPassBeginInfo passBegin{.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
+                                              .renderPass = pass.renderPass,
+                                              .framebuffer = pass.framebuffer,
+                                              .renderArea = VkRect2D{{0, 0}, pass.extent}};
+        const VkCommandBufferBeginInfo beginInfo{.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+
+        const vnd::Timer timer{};
+        std::size_t frames = 0;
+        do {  // NOLINT(*-avoid-do-while)
+            const int frameIndex = C_I(frames % framesInFlight);
+            VK_CHECK(vkBeginCommandBuffer(context.primary, &beginInfo), "failed to begin primary command buffer!");
+            vkCmdBeginRenderPass(context.primary, &passBegin, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+            lve::FrameInfo frameInfo{frameIndex, 0.F, context.primary, camera, context.globalSet, scene};
+            system.renderGameObjects(frameInfo, recorder, pass);
+            vkCmdEndRenderPass(context.primary);
+            VK_CHECK(vkEndCommandBuffer(context.primary), "failed to end primary command buffer!");
+            VK_CHECK(vkResetCommandBuffer(context.primary, 0), "failed to reset primary command buffer!");
+            ++frames;
+        } while(timer.make_time() < MIN_TIME_NS);
+        if(system.cullStats().visible != scene.size()) [[unlikely]] {
+            throw std::runtime_error(FORMAT("{} of {} objects visible", system.cullStats().visible, scene.size()));
+        }
+        return C_D(timer.make_time() / 1'000'000.0L) / C_D(frames);
+    }
+
+    void runSuite(const BenchContext &context, const std::shared_ptr<lve::Model> &model, std::size_t count) {
+        lve::SceneStore scene{};
+        for(std::size_t i = 0; i < count; ++i) {
+            auto object = lve::GameObject::createGameObject();
+            object.model = model;
+            object.transform.translation = {0.F, 0.F, 10.F};  // all in front of the camera, nothing is culled
+            scene.insert(std::move(object));
+        }
+        (void)scene.updateMatrices();
+
+        LINFO("{} objects, one draw each", count);
+        double single = 0.0;
+        for(std::size_t threads = 1; threads <= std::max(1U, std::thread::hardware_concurrency()); threads *= 2) {
+            const double ms = recordFrame(context, scene, threads);
+            if(threads == 1) { single = ms; }
+            LINFO("  {:>2} threads : {:>8.3f} ms/frame ({:.2f}x)", threads, ms, single / ms);
+        }
+    }
+}  // namespace
+
+// NOLINTNEXTLINE(bugprone-exception-escape)
+int main() {
+    INIT_LOG()
+    try {
+        lve::Window window{800, 600, "parallel_record_bench"};
+        lve::Device device{window};
+        lve::SwapChain swapChain{device, window.getExtent(), lve::SwapChain::DEFAULT_FRAMES_IN_FLIGHT};
+
+        auto globalPool = lve::DescriptorPool::Builder(device).setMaxSets(1).addPoolSize(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1).build();
+        auto globalSetLayout = lve::DescriptorSetLayout::Builder(device)
+                                   .addBinding(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_SHADER_STAGE_ALL_GRAPHICS)
+                                   .build();
+        lve::Buffer ubo{device, 256, 1, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT};
+        const auto uboInfo = ubo.descriptorInfo();
+        VkDescriptorSet globalSet = VK_NULL_HANDLE;
+        lve::DescriptorWriter(*globalSetLayout, *globalPool).writeBuffer(0, &uboInfo).build(globalSet);
+
+        VkCommandBuffer primary = VK_NULL_HANDLE;
+        const VkCommandBufferAllocateInfo allocInfo{.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+                                                    .commandPool = device.getCommandPool(),
+                                                    .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+                                                    .commandBufferCount = 1};
+        VK_CHECK(vkAllocateCommandBuffers(device.device(), &allocInfo, &primary), "failed to allocate primary command buffer!");
+
+        lve::Model::Builder builder{};
+        builder.loadModel(lve::Window::calculateRelativePathToSrcModels(curentP, "quad.obj").string());
+        const auto model = std::make_shared<lve::Model>(device, builder);
+        device.staging().waitIdle();
+
+        const BenchContext context{device, swapChain, *globalSetLayout, globalSet, primary};
+        for(const std::size_t count : {1'000, 10'000, 100'000}) { runSuite(context, model, count); }
+
+        vkDeviceWaitIdle(device.device());
+        vkFreeCommandBuffers(device.device(), device.getCommandPool(), 1, &primary);
+    } catch(const std::exception &e) {
+        LERROR("{}", e.what());
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+// NOLINTEND(*-include-cleaner)
@@ -0,0 +1,83 @@
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/SceneStore.hpp"
+#include "vulkrt/timer/Timer.hpp"
+
+namespace {
+    using lve::SceneStore;
+
+    // count objects, every one parented to the object parentOf(i) (NO_PARENT for roots), with small random transforms
+    template <typename ParentOf> std::vector<SceneStore::id_t> buildScene(SceneStore &scene, std::size_t count, ParentOf parentOf) {
+        std::mt19937 rng{42};  // NOLINT(*-msc51-cpp)
+        std::uniform_real_distribution<float> offset{-1.F, 1.F};
+        std::vector<SceneStore::id_t> ids;
+        ids.reserve(count);
+        for(std::size_t i = 0; i < count; ++i) {
+            auto object = lve::GameObject::createGameObject();
+            object.transform.translation = {offset(rng), offset(rng), offset(rng)};
+            object.transform.rotation = {offset(rng) * 0.1F, offset(rng) * 0.1F, offset(rng) * 0.1F};
+            ids.emplace_back(object.get_id());
+            scene.insert(std::move(object));
+            if(const std::size_t parent = parentOf(i); parent != i) { scene.setParent(ids.back(), ids[parent]); }
+        }
+        return ids;
+    }
+
+    template <typename ParentOf> void runSuite(const std::string &name, std::size_t count, ParentOf parentOf) {
+        SceneStore scene{};
+        const auto ids = buildScene(scene, count, parentOf);
+        std::mt19937 rng{7};  // NOLINT(*-msc51-cpp)
+        const auto touch = [&scene](SceneStore::id_t id) { scene.setTranslation(id, scene.translations()[scene.indexOf(id)]); };
+
+        bool attached = false;
+        vnd::Timer rebuildTimer{FORMAT("{} rebuild", name)};
+        const auto rebuild = rebuildTimer.time_it([&] {
+            // moving the last object forces the preorder rebuild
+            scene.setParent(ids.back(), attached ? SceneStore::NO_PARENT : ids.front());
+            attached = !attached;
+            (void)scene.updateMatrices();
+        });
+        std::size_t rootUpdated = 0;
+        vnd::Timer rootTimer{FORMAT("{} root", name)};
+        const auto root = rootTimer.time_it([&] {
+            touch(ids.front());
+            rootUpdated = scene.updateMatrices();
+        });
+        vnd::Timer leafTimer{FORMAT("{} leaf", name)};
+        const auto leaf = leafTimer.time_it([&] {
+            touch(ids[ids.size() - 2]);
+            (void)scene.updateMatrices();
+        });
+        std::uniform_int_distribution<std::size_t> pick{0, ids.size() - 1};
+        vnd::Timer randomTimer{FORMAT("{} 1% random", name)};
+        const auto random = randomTimer.time_it([&] {
+            for(std::size_t i = 0; i < ids.size() / 100; ++i) { touch(ids[pick(rng)]); }
+            (void)scene.updateMatrices();
+        });
+        vnd::Timer idleTimer{FORMAT("{} idle", name)};
+        const auto idle = idleTimer.time_it([&] { (void)scene.updateMatrices(); });
+
+        LINFO("{} ({} objects)", name, count);
+        LINFO("  full rebuild   : {}", rebuild);
+        LINFO("  root dirty     : {} ({} world matrices)", root, rootUpdated);
+        LINFO("  leaf dirty     : {}", leaf);
+        LINFO("  1% dirty       : {}", random);
+        LINFO("  nothing dirty  : {}", idle);
+    }
+}  // namespace
+
+// NOLINTNEXTLINE(bugprone-exception-escape)
+int main() {
+    INIT_LOG()
+    try {
+        for(const std::size_t count : {10'000, 50'000}) {
+            runSuite("flat", count, [](std::size_t i) { return i; });
+            runSuite("chain", count, [](std::size_t i) { return i == 0 ? i : i - 1; });
+            runSuite("4-ary tree", count, [](std::size_t i) { return i == 0 ? i : (i - 1) / 4; });
+        }
+    } catch(const std::exception &e) {
+        LERROR("{}", e.what());
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+// NOLINTEND(*-include-cleaner)
@@ -0,0 +1,84 @@
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/TransformKernel.hpp"
+#include "vulkrt/timer/Timer.hpp"
+
+namespace {
+    using lve::TransformKernel;
+    using Kernel = void (*)(std::span<const glm::vec3>, std::span<const glm::vec3>, std::span<const glm::vec3>, glm::mat4 *,
+                            glm::mat4 *) noexcept;
+
+    struct Transforms {
+        std::vector<glm::vec3> translations{};
+        std::vector<glm::vec3> rotations{};
+        std::vector<glm::vec3> scales{};
+    };
+
+    Transforms randomTransforms(const std::size_t count) {
+        std::mt19937 rng{42};  // NOLINT(*-msc51-cpp)
+        std::uniform_real_distribution<float> position{-100.F, 100.F};
+        std::uniform_real_distribution<float> angle{-glm::two_pi<float>(), glm::two_pi<float>()};
+        std::uniform_real_distribution<float> scale{0.25F, 4.F};
+        Transforms transforms{};
+        for(std::size_t i = 0; i < count; ++i) {
+            transforms.translations.emplace_back(position(rng), position(rng), position(rng));
+            transforms.rotations.emplace_back(angle(rng), angle(rng), angle(rng));
+            transforms.scales.emplace_back(scale(rng), scale(rng), scale(rng));
+        }
+        return transforms;
+    }
+
+    // runs kernel for at least a quarter of a second
+    double objectsPerMs(const Kernel kernel, const Transforms &transforms, std::vector<glm::mat4> &models,
+                        std::vector<glm::mat4> &normals) {
+        static constexpr long double MIN_TIME_NS = 250'000'000.0L;
+        const vnd::Timer timer{};
+        std::size_t runs = 0;
+        do {  // NOLINT(*-avoid-do-while)
+            kernel(transforms.translations, transforms.rotations, transforms.scales, models.data(), normals.data());
+            ++runs;
+        } while(timer.make_time() < MIN_TIME_NS);
+        return C_D(runs * transforms.translations.size()) / C_D(timer.make_time() / 1'000'000.0L);
+    }
+
+    float maxDifference(const std::vector<glm::mat4> &lhs, const std::vector<glm::mat4> &rhs) {
+        float difference = 0.F;
+        for(std::size_t i = 0; i < lhs.size(); ++i) {
+            for(int column = 0; column < 4; ++column) {
+                const glm::vec4 delta = glm::abs(lhs[i][column] - rhs[i][column]);
+                difference = std::max({difference, delta.x, delta.y, delta.z, delta.w});
+            }
+        }
+        return difference;
+    }
+
+    void runSuite(const std::size_t count) {
+        const auto transforms = randomTransforms(count);
+        std::vector<glm::mat4> scalarModels(count);
+        std::vector<glm::mat4> scalarNormals(count);
+        std::vector<glm::mat4> batchModels(count);
+        std::vector<glm::mat4> batchNormals(count);
+
+        const double scalarRate = objectsPerMs(&TransformKernel::computeScalar, transforms, scalarModels, scalarNormals);
+        const double batchRate = objectsPerMs(&TransformKernel::compute, transforms, batchModels, batchNormals);
+
+        // the polynomial sincos differs from std::sin/std::cos in the last bits
+        const float difference = std::max(maxDifference(scalarModels, batchModels), maxDifference(scalarNormals, batchNormals));
+        if(difference > 1e-4F) [[unlikely]] { throw std::runtime_error(FORMAT("batch result differs by {}", difference)); }
+        LINFO("{} objects, max difference {:.2e}", count, difference);
+        LINFO("  scalar : {:>10.0f} objects/ms", scalarRate);
+        LINFO("  {:<6} : {:>10.0f} objects/ms ({:.2f}x)", TransformKernel::isa(), batchRate, batchRate / scalarRate);
+    }
+}  // namespace
+
+// NOLINTNEXTLINE(bugprone-exception-escape)
+int main() {
+    INIT_LOG()
+    try {
+        for(const std::size_t count : {1'000, 10'000, 100'000, 1'000'000}) { runSuite(count); }
+    } catch(const std::exception &e) {
+        LERROR("{}", e.what());
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+// NOLINTEND(*-include-cleaner)
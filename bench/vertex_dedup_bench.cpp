@@ -0,0 +1,133 @@
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/VertexDedup.hpp"
+#include "vulkrt/Window.hpp"
+#include "vulkrt/timer/Timer.hpp"
+#include "vulkrt/tiny_obj_loader.h"
+#include "vulkrt/Util.hpp"
+
+namespace std {
+    template <> struct hash<lve::Model::Vertex> {
+        size_t operator()(lve::Model::Vertex const &vertex) const noexcept {
+            size_t seed = 0;
+            lve::hashCombine(seed, vertex.position, vertex.color, vertex.normal, vertex.uv);
+            return seed;
+        }
+    };
+}  // namespace std
+
+namespace {
+    using lve::Model;
+
+    std::vector<Model::Vertex> loadCorners(const std::string &filepath) {
+        tinyobj::attrib_t attrib;
+        std::vector<tinyobj::shape_t> shapes;
+        std::vector<tinyobj::material_t> materials;
+        std::string warn, err;
+        if(!tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, filepath.c_str())) { throw std::runtime_error(warn + err); }
+
+        std::vector<Model::Vertex> corners;
+        for(const auto &shape : shapes) {
+            for(const auto &index : shape.mesh.indices) {
+                Model::Vertex vertex{};
+                if(index.vertex_index >= 0) {
+                    const auto vi = C_ST(3 * index.vertex_index);
+                    vertex.position = {attrib.vertices[vi], attrib.vertices[vi + 1], attrib.vertices[vi + 2]};
+                    vertex.color = {attrib.colors[vi], attrib.colors[vi + 1], attrib.colors[vi + 2]};
+                }
+                if(index.normal_index >= 0) {
+                    const auto ni = C_ST(3 * index.normal_index);
+                    vertex.normal = {attrib.normals[ni], attrib.normals[ni + 1], attrib.normals[ni + 2]};
+                }
+                if(index.texcoord_index >= 0) {
+                    const auto ti = C_ST(2 * index.texcoord_index);
+                    vertex.uv = {attrib.texcoords[ti], attrib.texcoords[ti + 1]};
+                }
+                corners.emplace_back(vertex);
+            }
+        }
+        return corners;
+    }
+
+    // side x side quads, two triangles each, every interior vertex shared by six corners
+    std::vector<Model::Vertex> syntheticCorners(const std::size_t side) {
+        std::vector<Model::Vertex> corners;
+        corners.reserve(side * side * 6);
+        const auto at = [side](std::size_t x, std::size_t z) {
+            Model::Vertex vertex{};
+            vertex.position = {C_F(x), 0.f, C_F(z)};
+            vertex.color = {1.f, 1.f, 1.f};
+            vertex.normal = {0.f, -1.f, 0.f};
+            vertex.uv = {C_F(x) / C_F(side), C_F(z) / C_F(side)};
+            return vertex;
+        };
+        for(std::size_t z = 0; z < side; ++z) {
+            for(std::size_t x = 0; x < side; ++x) {
+                corners.emplace_back(at(x, z));
+                corners.emplace_back(at(x + 1, z));
+                corners.emplace_back(at(x, z + 1));
+                corners.emplace_back(at(x + 1, z));
+                corners.emplace_back(at(x + 1, z + 1));
+                corners.emplace_back(at(x, z + 1));
+            }
+        }
+        return corners;
+    }
+
+    void runSuite(const std::string &name, const std::vector<Model::Vertex> &corners) {
+        std::size_t uniqueCount = 0;
+
+        vnd::Timer mapTimer{FORMAT("{} unordered_map", name)};
+        const auto mapTime = mapTimer.time_it([&] {
+            std::vector<Model::Vertex> vertices;
+            std::vector<uint32_t> indices;
+            std::unordered_map<Model::Vertex, uint32_t> uniqueVertices{};
+            for(const auto &vertex : corners) {
+                if(uniqueVertices.count(vertex) == 0) {
+                    uniqueVertices[vertex] = C_UI32T(vertices.size());
+                    vertices.emplace_back(vertex);
+                }
+                indices.emplace_back(uniqueVertices[vertex]);
+            }
+            uniqueCount = vertices.size();
+        });
+
+        vnd::Timer flatTimer{FORMAT("{} VertexHashTable", name)};
+        const auto flatTime = flatTimer.time_it([&] {
+            std::vector<Model::Vertex> vertices;
+            std::vector<uint32_t> indices;
+            lve::VertexHashTable table{};
+            for(const auto &vertex : corners) {
+                const auto [index, inserted] = table.findOrInsert(vertex, C_UI32T(vertices.size()));
+                if(inserted) { vertices.emplace_back(vertex); }
+                indices.emplace_back(index);
+            }
+        });
+
+        vnd::Timer parTimer{FORMAT("{} deduplicateVertices", name)};
+        const auto parTime = parTimer.time_it([&] {
+            std::vector<Model::Vertex> vertices;
+            std::vector<uint32_t> indices;
+            lve::deduplicateVertices(corners.size(), [&corners](std::size_t corner) noexcept { return corners[corner]; }, vertices, indices);
+        });
+
+        LINFO("{}: {} corners, {} unique vertices", name, corners.size(), uniqueCount);
+        LINFO("  unordered_map       : {}", mapTime);
+        LINFO("  VertexHashTable     : {}", flatTime);
+        LINFO("  deduplicateVertices : {}", parTime);
+    }
+}  // namespace
+
+// NOLINTNEXTLINE(bugprone-exception-escape)
+int main() {
+    INIT_LOG()
+    try {
+        const auto vasePath = lve::Window::calculateRelativePathToSrcModels(curentP, "smooth_vase.obj").string();
+        runSuite("smooth_vase.obj", loadCorners(vasePath));
+        runSuite("synthetic 1024x1024 grid", syntheticCorners(1024));
+    } catch(const std::exception &e) {
+        LERROR("{}", e.what());
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+// NOLINTEND(*-include-cleaner)
@@ -4,30 +4,48 @@
 // NOLINTBEGIN(*-include-cleaner)
 #pragma once
 
-#include "GameObject.hpp"
+#include "AppConfig.hpp"
+#include "AssetStreamer.hpp"
+#include "BenchmarkReport.hpp"
+#include "BenchmarkScene.hpp"
+#include "FramePacer.hpp"
+#include "FrameTimeStats.hpp"
+#include "SceneStore.hpp"
 #include "Renderer.hpp"
 #include "Window.hpp"
-#include "Descriptors.hpp"
 
 namespace lve {
 
     class App {
     public:
-        App() noexcept;
+        /// @throws std::runtime_error when the configuration is not supported
+        explicit App(const AppConfig &appConfig = {});
         ~App() = default;
         App(const App &) = delete;
         App &operator=(const App &) = delete;
+        /// renders until the window closes or config.frameCount frames were measured, whichever comes first
         void run();
+        /// frame times measured by the last run()
+        [[nodiscard]] const FrameTimeStats &frameTimes() const noexcept { return frameTimeStats; }
+        /// per-frame CPU and GPU times of the last run(), filled only when config.reportPath is set
+        [[nodiscard]] const BenchmarkReport &report() const noexcept { return benchmarkReport; }
 
     private:
         void loadGameObjects();
+        void loadBenchmarkScene();
+        void streamModel(GameObject::id_t id, const std::string &filepath);
         void updateFrameRate(const float &frametime);
-        Window lveWindow{WWIDTH, WHEIGHT, WTITILE};
-        Device lveDevice{lveWindow};
-        Renderer lveRenderer{lveWindow, lveDevice};
         // note: order of declarations matters
-        std::unique_ptr<DescriptorPool> globalPool{};
-        GameObject::Map gameObjects;
+        AppConfig config;
+        std::unique_ptr<Window> lveWindow;  // nullptr when headless
+        Device lveDevice{lveWindow.get()};
+        std::unique_ptr<Renderer> lveRenderer;
+        AssetStreamer assetStreamer{lveDevice};
+        SceneStore scene;
+        FramePacer framePacer;
+        FrameTimeStats frameTimeStats;
+        CameraPath cameraPath;  // empty when the camera follows the keyboard
+        BenchmarkReport benchmarkReport;
         int frameCount;
         float totalTime;
     };
@@ -0,0 +1,62 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "SwapChain.hpp"
+
+namespace lve {
+
+    /// deployment settings of App, read from the command line
+    struct AppConfig {
+        enum class RenderSystem : std::uint8_t { Simple, Instanced, Indirect };
+
+        /// 1 for the lowest input latency, 3 to let the CPU run further ahead of the GPU
+        uint32_t framesInFlight = SwapChain::DEFAULT_FRAMES_IN_FLIGHT;
+        /// IMMEDIATE or MAILBOX run uncapped, FIFO waits for vblank
+        VkPresentModeKHR presentMode = VK_PRESENT_MODE_IMMEDIATE_KHR;
+        /// FramePacer target, 0 leaves the frame rate to the present mode
+        double targetFps = 0.0;
+        /// no window or surface, frames go to an OffscreenTarget of WWIDTH x WHEIGHT
+        bool headless = false;
+        /// measured frames before run() returns, 0 runs until the window is closed; warm-up frames are not counted
+        uint32_t frameCount = 0;
+        /// BenchmarkScene to load instead of the built-in objects, its camera path drives the camera
+        fs::path scenePath{};
+        /// CameraPath to follow, replaces the path of the scene
+        fs::path cameraPath{};
+        /// the camera of every measured frame is written here as a CameraPath at exit
+        fs::path recordCameraPath{};
+        /// simulated seconds per frame, 0 uses the measured frame time; a followed path without one steps 1/60 s
+        double timestep = 0.0;
+        /// per-frame CPU and GPU times, JSON for a .json extension and CSV otherwise
+        fs::path reportPath{};
+        /// Simple draws every object on its own, Instanced each model once, Indirect the whole scene from one indirect buffer
+        RenderSystem renderSystem = RenderSystem::Simple;
+        /// pipeline statistics queries and draw counters on SimpleRenderSystem, shown next to the frame rate
+        bool pipelineStatistics = false;
+        /// SimpleRenderSystem draws are recorded into secondaries by a ParallelRecorder of this many threads, 0 records inline
+        uint32_t recordThreads = 0;
+        /// Chrome trace-event JSON of the TRACE_SCOPE / AutoTimer scopes, written at exit; tracing is off without it
+        fs::path tracePath{};
+
+        static constexpr uint32_t DEFAULT_HEADLESS_FRAMES = 1000;
+        static constexpr uint32_t MAX_RECORD_THREADS = 64;
+
+        /**
+         * @brief Parses options of the form --name=value, args excludes the program name.
+         *
+         * Recognized: --frames-in-flight=N (1 to SwapChain::MAX_FRAMES_IN_FLIGHT),
+         * --present-mode=fifo|fifo-relaxed|mailbox|immediate, --target-fps=F (0 for uncapped), --headless and
+         * --frames=N. A headless run without --frames renders DEFAULT_HEADLESS_FRAMES frames. Benchmark runs use
+         * --scene=FILE, --camera-path=FILE, --record-camera=FILE, --timestep=S and --report=FILE. Instrumentation uses
+         * --render-system=simple|instanced|indirect, --pipeline-stats, which needs simple or instanced, and --trace=FILE.
+         * --record-threads=N (1 to MAX_RECORD_THREADS) also needs simple or instanced and excludes --pipeline-stats.
+         * @throws std::runtime_error on unknown options and invalid values.
+         */
+        [[nodiscard]] static AppConfig fromArgs(std::span<char *const> args);
+    };
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
@@ -0,0 +1,68 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "MeshCache.hpp"
+#include "ThreadPool.hpp"
+
+#include <unordered_map>
+
+namespace lve {
+
+    /**
+     * @brief Loads models in the background.
+     *
+     * requestModel() queues the import (cache lookup or OBJ parse) on a worker pool. update(), called once per frame on
+     * the render thread, turns finished imports into Models, which queues their uploads on the device StagingRing, and
+     * hands every Model whose upload is ready to the callbacks waiting for it. Concurrent requests for the same path
+     * share one import, and a path already loaded is served from the live Model.
+     */
+    class AssetStreamer {
+    public:
+        using ModelCallback = std::function<void(std::shared_ptr<Model>)>;
+
+        /// bytes of vertex/index data turned into Models per update(), bounds the per-frame staging cost
+        static inline constexpr std::size_t DEFAULT_UPLOAD_BUDGET = std::size_t{64} << 20;
+
+        explicit AssetStreamer(Device &device, std::size_t workerCount = 0, std::size_t uploadBudget = DEFAULT_UPLOAD_BUDGET);
+        ~AssetStreamer();
+
+        AssetStreamer(const AssetStreamer &) = delete;
+        AssetStreamer &operator=(const AssetStreamer &) = delete;
+        AssetStreamer(AssetStreamer &&) = delete;
+        AssetStreamer &operator=(AssetStreamer &&) = delete;
+
+        /// onReady runs on the thread calling update(), once the model can be drawn
+        void requestModel(const std::string &filepath, ModelCallback onReady);
+        void update();
+
+        /// requests not handed out yet, whether still parsing or uploading
+        [[nodiscard]] std::size_t pendingCount() const noexcept { return waiting.size(); }
+
+    private:
+        struct Imported {
+            std::string filepath;
+            std::optional<MeshCache::Mesh> mesh{};
+            std::string error{};
+        };
+
+        struct Uploading {
+            std::string filepath;
+            std::shared_ptr<Model> model;
+        };
+
+        Device &lveDevice;
+        std::size_t uploadBudget;
+        std::unordered_map<std::string, std::vector<ModelCallback>> waiting{};
+        std::unordered_map<std::string, std::weak_ptr<Model>> loaded{};
+        std::vector<Uploading> uploading{};
+        std::mutex importedMutex{};
+        std::deque<Imported> imported{};
+        // last member: workers stop before the state they write to is destroyed
+        ThreadPool workers;
+    };
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
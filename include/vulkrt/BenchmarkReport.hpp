@@ -0,0 +1,48 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "FrameTimeStats.hpp"
+
+namespace lve {
+
+    /**
+     * @brief Per-frame timings of a benchmark run, written as CSV or JSON for regression tracking.
+     *
+     * GPU times arrive frames in flight after their CPU row, so rows are added with gpuMs unset and filled in later by
+     * frame number; frames whose GPU time never arrived (no timestamp support) are written as empty / null.
+     */
+    class BenchmarkReport {
+    public:
+        struct Row {
+            std::uint64_t frame = 0;  ///< Renderer frame number
+            double time = 0.0;        ///< simulated seconds since the first measured frame
+            double frameMs = 0.0;     ///< wall time since the previous frame
+            double cpuMs = 0.0;       ///< update + recording of this frame, from beginFrame returning to endFrame
+            double submitMs = 0.0;    ///< endFrame: queue submit and present
+            std::optional<double> gpuMs{};
+        };
+
+        void reserve(std::size_t frames) { rows.reserve(frames); }
+        /// frame numbers must increase
+        void add(const Row &row);
+        /// ignored for frames that are not in the report, e.g. warm-up frames
+        void setGpuTime(std::uint64_t frame, double gpuMs) noexcept;
+        [[nodiscard]] std::span<const Row> values() const noexcept { return rows; }
+
+        [[nodiscard]] FrameTimeStats cpuStats() const;
+        [[nodiscard]] FrameTimeStats gpuStats() const;
+
+        void writeCsv(std::ostream &out) const;
+        void writeJson(std::ostream &out) const;
+        /// JSON for a .json extension, CSV otherwise
+        void write(const fs::path &filepath) const;
+
+    private:
+        std::vector<Row> rows;
+    };
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
@@ -0,0 +1,63 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "GameObject.hpp"
+
+namespace lve {
+
+    /// camera keyframes sampled at fixed times, so a run sees the same views whatever its frame rate
+    class CameraPath {
+    public:
+        struct Keyframe {
+            float time;  // seconds from the start of the run
+            glm::vec3 translation;
+            glm::vec3 rotation;
+        };
+
+        /// keyframes must be added in ascending time
+        void add(const Keyframe &keyframe);
+        void clear() noexcept { keyframes.clear(); }
+        [[nodiscard]] bool empty() const noexcept { return keyframes.empty(); }
+        [[nodiscard]] float duration() const noexcept { return keyframes.empty() ? 0.F : keyframes.back().time; }
+        [[nodiscard]] std::span<const Keyframe> values() const noexcept { return keyframes; }
+
+        /// linear interpolation between the surrounding keyframes, held at the ends
+        [[nodiscard]] Keyframe sample(float time) const noexcept;
+        /// writes the keyframes as `camera` statements, loadable with BenchmarkScene::load
+        void save(const fs::path &filepath) const;
+
+    private:
+        std::vector<Keyframe> keyframes;
+    };
+
+    /**
+     * @brief Objects and camera path of a benchmark run, read from a line based text file.
+     *
+     * One statement per line, `#` starts a comment, angles are radians:
+     *
+     *     object <model> tx ty tz [rx ry rz [sx sy sz]]
+     *     grid <model> countX countZ spacing [scale]
+     *     camera <time> tx ty tz rx ry rz
+     *
+     * `grid` places countX * countZ objects on the XZ plane centred on the origin. Model paths are relative to the
+     * scene file, or name a file of the repository's models directory. A recorded path (CameraPath::save) is a scene
+     * file with only `camera` statements.
+     */
+    struct BenchmarkScene {
+        struct Object {
+            fs::path model;
+            TransformComponent transform;
+        };
+
+        std::vector<Object> objects;
+        CameraPath cameraPath;
+
+        /// @throws std::runtime_error with the file and line of the first malformed statement
+        [[nodiscard]] static BenchmarkScene load(const fs::path &filepath);
+    };
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
@@ -10,7 +10,8 @@ namespace lve {
     class Buffer {
     public:
         Buffer(Device &device, VkDeviceSize instanceSize, uint32_t instanceCount, VkBufferUsageFlags usageFlags,
-               VkMemoryPropertyFlags memoryPropertyFlags, VkDeviceSize minOffsetAlignment = 1);
+               VkMemoryPropertyFlags memoryPropertyFlags, VkDeviceSize minOffsetAlignment = 1,
+               VkSharingMode sharingMode = VK_SHARING_MODE_EXCLUSIVE);
         ~Buffer();
 
         Buffer(const Buffer &) = delete;
@@ -44,7 +45,7 @@ namespace lve {
         Device &lveDevice;
         void *mapped = nullptr;
         VkBuffer buffer = VK_NULL_HANDLE;
-        VkDeviceMemory memory = VK_NULL_HANDLE;
+        Allocation allocation{};
 
         VkDeviceSize bufferSize;
         uint32_t instanceCount;
@@ -19,6 +19,13 @@ namespace lve {
 
         const glm::mat4 &getProjection() const noexcept { return projectionMatrix; }
         const glm::mat4 &getView() const noexcept { return viewMatrix; }
+        /**
+         * @brief World space frustum planes of projection * view: left, right, bottom, top, near, far.
+         *
+         * Each plane is (normal, distance) with the normal pointing inwards and normalized, so a sphere is outside
+         * when dot(normal, center) + distance < -radius for any plane.
+         */
+        [[nodiscard]] std::array<glm::vec4, 6> getFrustumPlanes() const noexcept;
 
     private:
         glm::mat4 projectionMatrix{1.f};
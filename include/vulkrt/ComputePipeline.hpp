@@ -0,0 +1,33 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "Device.hpp"
+
+namespace lve {
+
+    /**
+     * @brief A compute pipeline built from a single SPIR-V shader, the compute counterpart of Pipeline.
+     *
+     * The layout is owned by the caller, like PipelineConfigInfo::pipelineLayout for graphics pipelines, and creation
+     * goes through the device pipeline cache.
+     */
+    class ComputePipeline {
+    public:
+        ComputePipeline(Device &device, const std::string &compFilepath, VkPipelineLayout pipelineLayout);
+        ComputePipeline(const ComputePipeline &other) = delete;
+        ComputePipeline &operator=(const ComputePipeline &other) = delete;
+        ~ComputePipeline();
+
+        void bind(VkCommandBuffer commandBuffer) const noexcept;
+
+    private:
+        Device &lveDevice;
+        VkPipeline computePipeline{};
+        VkShaderModule compShaderModule{};
+    };
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
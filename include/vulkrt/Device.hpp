@@ -1,9 +1,13 @@
 // NOLINTBEGIN(*-include-cleaner)
 #pragma once
 
+#include "MemoryAllocator.hpp"
+#include "PipelineCache.hpp"
 #include "Window.hpp"
 
 namespace lve {
+    class MeshPool;
+    class StagingRing;
 
     struct SwapChainSupportDetails {
         VkSurfaceCapabilitiesKHR capabilities{};
@@ -15,9 +19,13 @@ namespace lve {
     struct QueueFamilyIndices {
         uint32_t graphicsFamily{};
         uint32_t presentFamily{};
+        uint32_t transferFamily{};
         bool graphicsFamilyHasValue = false;
         bool presentFamilyHasValue = false;
+        bool transferFamilyHasValue = false;
         [[nodiscard]] bool isComplete() const noexcept { return graphicsFamilyHasValue && presentFamilyHasValue; }
+        /// true when uploads run on their own queue family and need an ownership transfer to graphics
+        [[nodiscard]] bool hasDedicatedTransfer() const noexcept { return transferFamilyHasValue && transferFamily != graphicsFamily; }
     };
 
     class Device {
@@ -29,6 +37,11 @@ namespace lve {
 #endif
 
         explicit Device(Window &window) noexcept;
+        /**
+         * @brief window nullptr creates a headless device: no surface, no VK_KHR_swapchain and no GLFW instance extensions,
+         * presentQueue() is the graphics queue. Rendering then goes through an OffscreenTarget.
+         */
+        explicit Device(Window *window);
         ~Device();
 
         // Not copyable or movable
@@ -40,25 +53,42 @@ namespace lve {
         [[nodiscard]] VkCommandPool getCommandPool() const noexcept { return commandPool; }
         [[nodiscard]] VkDevice device() const noexcept { return device_; }
         [[nodiscard]] VkSurfaceKHR surface() const noexcept { return surface_; }
+        [[nodiscard]] bool isHeadless() const noexcept { return window == nullptr; }
         [[nodiscard]] VkQueue graphicsQueue() const noexcept { return graphicsQueue_; }
         [[nodiscard]] VkQueue presentQueue() const noexcept { return presentQueue_; }
+        /// transfer-only queue when the device has one, the graphics queue otherwise
+        [[nodiscard]] VkQueue transferQueue() const noexcept { return transferQueue_; }
+        [[nodiscard]] MemoryAllocator &allocator() const noexcept { return *allocator_; }
+        [[nodiscard]] StagingRing &staging() const noexcept { return *stagingRing_; }
+        /// shared vertex/index megabuffers for Model geometry
+        [[nodiscard]] MeshPool &meshPool() const noexcept { return *meshPool_; }
+        /// optional features actually enabled on the logical device
+        [[nodiscard]] const VkPhysicalDeviceFeatures &features() const noexcept { return enabledFeatures; }
+        /// shared by every pipeline, persisted next to the executable's working directory
+        [[nodiscard]] VkPipelineCache pipelineCache() const noexcept { return pipelineCache_->handle(); }
+        void addPipelineCreationTime(long double nanoseconds) const noexcept { pipelineCache_->addCreationTime(nanoseconds); }
 
         [[nodiscard]] SwapChainSupportDetails getSwapChainSupport() { return querySwapChainSupport(physicalDevice); }
         [[nodiscard]] uint32_t findMemoryType(uint32_t typeFilter,const VkMemoryPropertyFlags &properties);
         [[nodiscard]] QueueFamilyIndices findPhysicalQueueFamilies() { return findQueueFamilies(physicalDevice); }
+        [[nodiscard]] VkPhysicalDevice getPhysicalDevice() const noexcept { return physicalDevice; }
         [[nodiscard]] VkFormat findSupportedFormat(const std::vector<VkFormat> &candidates, VkImageTiling tiling,
                                                    VkFormatFeatureFlags features);
 
         // Buffer Helper Functions
+        /// VK_SHARING_MODE_CONCURRENT shares the buffer between the graphics and a dedicated transfer family, it is exclusive
+        /// when both are the same family
         void createBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer &buffer,
-                          VkDeviceMemory &bufferMemory);
+                          Allocation &allocation, VkSharingMode sharingMode = VK_SHARING_MODE_EXCLUSIVE);
+        void destroyBuffer(VkBuffer &buffer, Allocation &allocation) noexcept;
         [[nodiscard]] VkCommandBuffer beginSingleTimeCommands() noexcept;
         void endSingleTimeCommands(VkCommandBuffer commandBuffer) noexcept;
         void copyBuffer(const VkBuffer &srcBuffer,const VkBuffer &dstBuffer, VkDeviceSize size) noexcept;
         void copyBufferToImage(const VkBuffer &buffer, VkImage image, uint32_t width, uint32_t height, uint32_t layerCount) noexcept;
 
         void createImageWithInfo(const VkImageCreateInfo &imageInfo, VkMemoryPropertyFlags properties, VkImage &image,
-                                 VkDeviceMemory &imageMemory);
+                                 Allocation &allocation);
+        void destroyImage(VkImage &image, Allocation &allocation) noexcept;
 
         VkPhysicalDeviceProperties properties;
 
@@ -68,7 +98,11 @@ namespace lve {
         void createSurface();
         void pickPhysicalDevice();
         void createLogicalDevice();
+        void createAllocator();
+        void createPipelineCache();
         void createCommandPool();
+        void createStagingRing();
+        void createMeshPool();
 
         // helper functions
         [[nodiscard]] bool isDeviceSuitable(VkPhysicalDevice device);
@@ -83,16 +117,22 @@ namespace lve {
         VkInstance instance;
         VkDebugUtilsMessengerEXT debugMessenger;
         VkPhysicalDevice physicalDevice = VK_NULL_HANDLE;
-        Window &window;
+        Window *window;
         VkCommandPool commandPool;
 
         VkDevice device_;
-        VkSurfaceKHR surface_;
+        VkSurfaceKHR surface_ = VK_NULL_HANDLE;
         VkQueue graphicsQueue_;
         VkQueue presentQueue_;
+        VkQueue transferQueue_;
+        std::unique_ptr<MemoryAllocator> allocator_;
+        std::unique_ptr<StagingRing> stagingRing_;
+        std::unique_ptr<MeshPool> meshPool_;
+        VkPhysicalDeviceFeatures enabledFeatures{};
+        std::unique_ptr<PipelineCache> pipelineCache_;
 
         const std::vector<const char *> validationLayers{"VK_LAYER_KHRONOS_validation"};
-        const std::vector<const char *> deviceExtensions{VK_KHR_SWAPCHAIN_EXTENSION_NAME};
+        std::vector<const char *> deviceExtensions;
     };
 
 }  // namespace lve
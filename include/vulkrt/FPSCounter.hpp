@@ -12,6 +12,8 @@ public:
     void frame();
     void frameInTitle();
     void updateFPS() noexcept;
+    /// extra text shown after the frame rate by frame() and frameInTitle(), e.g. per-frame draw statistics
+    void setDetail(std::string detail) noexcept { m_detail = std::move(detail); }
     [[nodiscard]] long double getFPS() const noexcept;
     [[nodiscard]] long double getFrameTime() const noexcept { return frameTime; };
     [[nodiscard]] long double getMsPerFrame() const noexcept;
@@ -28,5 +30,6 @@ private:
     GLFWwindow *m_window;
     std::string_view m_title;
     std::string ms_per_frameComposition;
+    std::string m_detail;
 };
 // NOLINTEND(*-include-cleaner)
@@ -5,17 +5,17 @@
 #pragma once
 
 #include "Camera.hpp"
-#include "GameObject.hpp"
+#include "SceneStore.hpp"
 
 #include "vulkanCheck.hpp"
 
 namespace lve {
     struct FrameInfo {
-        int frameIndex;
+        int frameIndex;  // frame-in-flight slot, its resources are free to reuse, see Renderer::beginFrame
         float frameTime;
         VkCommandBuffer commandBuffer;
         Camera &camera;
         VkDescriptorSet globalDescriptorSet;
-        GameObject::Map &gameObjects;
+        SceneStore &scene;
     };
 }  // namespace lve
\ No newline at end of file
@@ -0,0 +1,56 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "headers.hpp"
+
+namespace lve {
+
+    /**
+     * @brief Frame limiter and input-to-present latency meter for the main loop.
+     *
+     * Call wait() at the top of the loop, markInput() right after polling events and markPresent() once the frame has
+     * been handed to vkQueuePresentKHR. Sleeping before the input is sampled, rather than after the present, keeps
+     * the sampled input as fresh as possible. The latency measured is the CPU side one, up to the present call; the
+     * time the image spends queued in the swap chain is set by the present mode and the frames in flight.
+     *
+     * The deadline advances by the target frame time from the previous deadline, so oversleeping one frame is paid
+     * back on the next; after a stall longer than a frame it restarts from now instead of bursting to catch up.
+     */
+    class FramePacer {
+    public:
+        using clock = ch::steady_clock;
+
+        struct Stats {
+            double lastLatencyMs = 0.0;     ///< input-to-present of the last frame
+            double averageLatencyMs = 0.0;  ///< exponential moving average over roughly the last 64 frames
+            double maxLatencyMs = 0.0;      ///< since construction or the last resetStats()
+            double lastSleepMs = 0.0;       ///< time wait() spent in the last call
+            std::uint64_t frames = 0;
+        };
+
+        /// targetFps 0 runs uncapped, wait() then returns immediately
+        explicit FramePacer(double targetFps = 0.0) noexcept;
+
+        void setTargetFps(double targetFps) noexcept;
+        [[nodiscard]] bool isCapped() const noexcept { return targetFrameTime.count() > 0; }
+
+        /// sleeps until the next frame deadline
+        void wait() noexcept;
+        void markInput() noexcept;
+        void markPresent() noexcept;
+
+        [[nodiscard]] const Stats &stats() const noexcept { return frameStats; }
+        void resetStats() noexcept { frameStats = Stats{}; }
+
+    private:
+        clock::duration targetFrameTime{};
+        clock::time_point deadline{};
+        clock::time_point inputTime{};
+        Stats frameStats{};
+    };
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
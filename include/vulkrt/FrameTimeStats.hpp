@@ -0,0 +1,41 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "headers.hpp"
+
+namespace lve {
+
+    /// per-frame times of a run, summarized as percentiles once the run is over
+    class FrameTimeStats {
+    public:
+        struct Summary {
+            std::size_t frames = 0;
+            double minMs = 0.0;
+            double meanMs = 0.0;
+            double p50Ms = 0.0;
+            double p95Ms = 0.0;
+            double p99Ms = 0.0;
+            double maxMs = 0.0;
+
+            [[nodiscard]] double fps() const noexcept { return meanMs > 0.0 ? 1000.0 / meanMs : 0.0; }
+        };
+
+        void reserve(std::size_t frames) { samples.reserve(frames); }
+        void add(double frameMs) { samples.emplace_back(frameMs); }
+        void clear() noexcept { samples.clear(); }
+        [[nodiscard]] std::size_t size() const noexcept { return samples.size(); }
+        [[nodiscard]] std::span<const double> values() const noexcept { return samples; }
+
+        /// nearest-rank percentiles over a sorted copy of the samples
+        [[nodiscard]] Summary summarize() const;
+        void log(std::string_view label) const;
+
+    private:
+        std::vector<double> samples;
+    };
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
@@ -0,0 +1,59 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "headers.hpp"
+
+namespace lve {
+
+    /**
+     * @brief Batch bounding sphere vs frustum tests.
+     *
+     * Spheres are kept as a structure of arrays so the six plane tests run on 8 (AVX2) or 4 (SSE2) spheres per
+     * instruction; the instruction set is picked at compile time from the -march=native / /arch:AVX2 build of
+     * vulkrt-core, with a scalar loop for the tail and for other targets.
+     */
+    class FrustumCuller {
+    public:
+        using Planes = std::array<glm::vec4, 6>;
+
+        struct Stats {
+            uint32_t tested = 0;
+            uint32_t visible = 0;
+
+            [[nodiscard]] uint32_t culled() const noexcept { return tested - visible; }
+        };
+
+        /// world space spheres, one entry per object
+        struct SphereBatch {
+            std::vector<float> centerX{};
+            std::vector<float> centerY{};
+            std::vector<float> centerZ{};
+            std::vector<float> radius{};
+
+            void clear() noexcept;
+            void reserve(std::size_t count);
+            void push(const glm::vec4 &sphere);
+            [[nodiscard]] std::size_t size() const noexcept { return radius.size(); }
+        };
+
+        /// moves an object space sphere (xyz center, w radius) to world space, the radius grows with the largest axis scale
+        [[nodiscard]] static glm::vec4 transformSphere(const glm::mat4 &modelMatrix, const glm::vec4 &sphere) noexcept;
+        [[nodiscard]] static bool isVisible(const Planes &planes, const glm::vec4 &worldSphere) noexcept;
+
+        /**
+         * @brief Tests every sphere of the batch against planes (as returned by Camera::getFrustumPlanes).
+         * @param visible Receives the indices of the visible spheres in ascending order, needs room for batch.size().
+         * @return Number of visible spheres.
+         */
+        static std::size_t cull(const Planes &planes, const SphereBatch &batch, uint32_t *visible) noexcept;
+        /// one sphere at a time, the reference for cull()
+        static std::size_t cullScalar(const Planes &planes, const SphereBatch &batch, uint32_t *visible) noexcept;
+        /// name of the instruction set cull() was compiled for
+        [[nodiscard]] static std::string_view isa() noexcept;
+    };
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
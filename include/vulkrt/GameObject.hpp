@@ -13,9 +13,14 @@ namespace lve {
         glm::vec3 scale{1.F, 1.F, 1.F};
         glm::vec3 rotation;
 
-        [[nodiscard]] glm::mat4 mat4() const;
+        [[nodiscard]] glm::mat4 mat4() const { return computeMat4(translation, rotation, scale); }
 
-        [[nodiscard]] glm::mat4 normalMatrix() const;
+        [[nodiscard]] glm::mat4 normalMatrix() const { return computeNormalMatrix(rotation, scale); }
+
+        // component-wise forms, used by stores that keep the components in separate arrays
+        [[nodiscard]] static glm::mat4 computeMat4(const glm::vec3 &translation, const glm::vec3 &rotation,
+                                                   const glm::vec3 &scale) noexcept;
+        [[nodiscard]] static glm::mat4 computeNormalMatrix(const glm::vec3 &rotation, const glm::vec3 &scale) noexcept;
     };
 
     class GameObject {
@@ -0,0 +1,115 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "Device.hpp"
+
+namespace lve {
+
+    /**
+     * @brief GPU execution times of named scopes of the frame command buffer, measured with timestamp queries.
+     *
+     * Every frame in flight owns MAX_SCOPES begin/end query pairs. A frame's results are read without waiting when its
+     * slot comes around again in beginFrame, after the slot's fence has signaled, so times lag the CPU by the frames in
+     * flight and reading them never stalls. Scopes may nest; a name used several times in a frame is summed.
+     *
+     * Timestamps cannot be written inside a subpass recorded with VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS, bracket
+     * the whole render pass there instead. Without graphics timestamp support every call is a no-op.
+     */
+    class GpuProfiler {
+    public:
+        static constexpr uint32_t MAX_SCOPES = 32;  ///< per frame, further scopes are not measured
+        static constexpr uint32_t INVALID_SCOPE = std::numeric_limits<uint32_t>::max();
+
+        struct ScopeStats {
+            std::string name;
+            double lastMs = 0.0;
+            double averageMs = 0.0;  ///< exponential moving average over roughly the last 64 frames
+            double maxMs = 0.0;
+            std::uint64_t frames = 0;  ///< frames the scope was measured in
+        };
+
+        /// GPU time of a whole frame, see beginFrame
+        struct FrameTime {
+            std::uint64_t frame;
+            double ms;
+        };
+
+        /// RAII bracket for one scope
+        class Scope {
+        public:
+            Scope(GpuProfiler &profiler, VkCommandBuffer commandBuffer, std::string_view name)
+              : profiler{profiler}, commandBuffer{commandBuffer}, query{profiler.beginScope(commandBuffer, name)} {}
+            ~Scope() { profiler.endScope(commandBuffer, query); }
+
+            Scope(const Scope &) = delete;
+            Scope &operator=(const Scope &) = delete;
+            Scope(Scope &&) = delete;
+            Scope &operator=(Scope &&) = delete;
+
+        private:
+            GpuProfiler &profiler;
+            VkCommandBuffer commandBuffer;
+            uint32_t query;
+        };
+
+        GpuProfiler(Device &device, uint32_t framesInFlight);
+        ~GpuProfiler();
+
+        GpuProfiler(const GpuProfiler &) = delete;
+        GpuProfiler &operator=(const GpuProfiler &) = delete;
+
+        [[nodiscard]] bool isEnabled() const noexcept { return queryPool != VK_NULL_HANDLE; }
+
+        /// reads back the slot's previous frame, resets its queries and opens the "frame" scope; call right after
+        /// vkBeginCommandBuffer, once the slot's fence has signaled
+        void beginFrame(VkCommandBuffer commandBuffer, uint32_t frameIndex, uint64_t frameNumber);
+        /// closes the "frame" scope, call right before vkEndCommandBuffer
+        void endFrame(VkCommandBuffer commandBuffer) noexcept;
+
+        /// index of the stats of name, registered on first use
+        [[nodiscard]] uint32_t scopeId(std::string_view name);
+        /// @return the scope's query pair for endScope, INVALID_SCOPE when the frame is out of queries
+        uint32_t beginScope(VkCommandBuffer commandBuffer, uint32_t id,
+                            VkPipelineStageFlagBits stage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT) noexcept;
+        uint32_t beginScope(VkCommandBuffer commandBuffer, std::string_view name) { return beginScope(commandBuffer, scopeId(name)); }
+        void endScope(VkCommandBuffer commandBuffer, uint32_t query,
+                      VkPipelineStageFlagBits stage = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT) noexcept;
+
+        /// rolling times of every scope seen so far, in order of first use
+        [[nodiscard]] std::span<const ScopeStats> scopes() const noexcept { return stats; }
+        /**
+         * @brief Whole-frame times read back since the last call, oldest first.
+         * @param afterIdle Also collect the frames still in flight, the device must be idle.
+         */
+        [[nodiscard]] std::vector<FrameTime> takeFrameTimes(bool afterIdle = false);
+        void log() const;
+
+    private:
+        struct Slot {
+            std::vector<uint32_t> scopes;  // stats index of each query pair written this frame
+            std::uint64_t frameNumber = 0;
+            bool pending = false;  // written but not read back yet
+        };
+
+        void readBack(uint32_t frameIndex, bool wait);
+
+        Device &lveDevice;
+        VkQueryPool queryPool = VK_NULL_HANDLE;
+        double timestampPeriodMs = 0.0;
+        uint64_t timestampMask = 0;
+        std::vector<Slot> slots;
+        uint32_t currentSlot = 0;
+        uint32_t frameScope = INVALID_SCOPE;
+        uint32_t frameQuery = INVALID_SCOPE;
+        std::vector<ScopeStats> stats;
+        std::vector<FrameTime> frameTimes;
+        // readBack scratch
+        std::vector<uint64_t> results;
+        std::vector<double> scopeMs;
+    };
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
@@ -0,0 +1,114 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "Buffer.hpp"
+#include "ComputePipeline.hpp"
+#include "Descriptors.hpp"
+#include "Device.hpp"
+#include "FrameInfo.hpp"
+#include "FrustumCuller.hpp"
+#include "SceneStore.hpp"
+#include "Pipeline.hpp"
+
+namespace lve {
+
+    /**
+     * @brief GPU-driven render system: the whole scene is drawn from a VkDrawIndexedIndirectCommand buffer.
+     *
+     * Every frame the ready objects are grouped by Model; each group becomes one indirect command addressing the
+     * model's range in the device MeshPool and a contiguous run of Model::InstanceData in the frame's instance buffer.
+     * With multiDrawIndirect the scene is a single vkCmdDrawIndexedIndirect, so recording cost no longer depends on the
+     * object count. Models that did not fit into the MeshPool are drawn through the regular bind/draw path.
+     *
+     * Objects outside the camera frustum are culled by bounding sphere. With CullMode::Gpu prepare() records a compute
+     * pass (cull.comp) that tests every pooled object and compacts the survivors into their command's instance run;
+     * CullMode::Cpu runs the same test while the buffers are filled.
+     */
+    class IndirectRenderSystem {
+    public:
+        enum class CullMode : std::uint8_t {
+            None,  ///< draw every ready object
+            Cpu,   ///< test bounding spheres while filling the instance buffer
+            Gpu,   ///< test bounding spheres in a compute pass that writes the instance counts
+        };
+
+        using CullStats = FrustumCuller::Stats;
+
+        /// framesInFlight sizes the per-frame buffers and descriptor sets, see Renderer::getFramesInFlight
+        IndirectRenderSystem(Device &device, VkRenderPass renderPass, VkDescriptorSetLayout globalSetLayout, uint32_t framesInFlight,
+                             CullMode cullMode = CullMode::Gpu);
+        ~IndirectRenderSystem();
+
+        IndirectRenderSystem(const IndirectRenderSystem &) = delete;
+        IndirectRenderSystem &operator=(const IndirectRenderSystem &) = delete;
+
+        /// fills the frame's buffers and records the culling dispatch, call before the render pass begins
+        void prepare(FrameInfo &frameInfo);
+        /// records the draws prepared for frameInfo, inside the render pass
+        void renderGameObjects(FrameInfo &frameInfo);
+
+        /// commands recorded in the last call, for stats overlays
+        [[nodiscard]] uint32_t drawCount() const noexcept { return C_UI32T(groups.size()); }
+        /// objects tested/visible; with CullMode::Gpu the counts are read back and lag by the frames in flight
+        [[nodiscard]] const CullStats &cullStats() const noexcept { return stats; }
+
+    private:
+        struct DrawGroup {
+            Model *model;
+            uint32_t firstInstance;
+            uint32_t instanceCount;
+            uint32_t command;
+        };
+
+        struct FrameResources {
+            std::unique_ptr<Buffer> instances;
+            std::unique_ptr<Buffer> commands;
+            std::unique_ptr<Buffer> objects;   // cull.comp input
+            std::unique_ptr<Buffer> counters;  // cull.comp visible counter, read back when the slot comes around
+            VkDescriptorSet cullSet = VK_NULL_HANDLE;
+            bool descriptorsDirty = true;
+            uint32_t gpuTested = 0;  // objects the last dispatch of this slot tested
+            uint32_t cpuTested = 0;
+            uint32_t cpuVisible = 0;
+            // what the objects buffer holds, see buildCommands
+            SceneStore::stamp_t uploadedStamp = 0;
+            uint32_t uploadedCount = 0;
+            std::vector<uint32_t> uploadedBases;
+        };
+
+        void createPipelineLayout(VkDescriptorSetLayout globalSetLayout);
+        void createPipeline(VkRenderPass renderPass);
+        void createCullResources();
+        /// groups the ready objects per Model and fills the instance, command and object buffers of frameIndex
+        void buildCommands(const FrameInfo &frameInfo);
+        void recordCull(const FrameInfo &frameInfo);
+        /// @return true when the buffer had to be (re)created
+        static bool reserve(Device &device, std::unique_ptr<Buffer> &buffer, VkDeviceSize stride, std::size_t count,
+                            VkBufferUsageFlags usage);
+
+        Device &lveDevice;
+        CullMode cullMode;
+
+        std::unique_ptr<Pipeline> lvePipeline;
+        VkPipelineLayout pipelineLayout{};
+
+        std::unique_ptr<ComputePipeline> cullPipeline;
+        VkPipelineLayout cullPipelineLayout{};
+        std::unique_ptr<DescriptorSetLayout> cullSetLayout;
+        std::unique_ptr<DescriptorPool> cullPool;
+
+        std::vector<FrameResources> frames;
+        uint32_t commandCount = 0;
+        uint32_t gpuObjectCount = 0;
+        CullStats stats{};
+        // per-frame scratch, kept to reuse its storage
+        std::unordered_map<const Model *, uint32_t> groupIndex;
+        std::vector<DrawGroup> groups;
+        std::vector<uint32_t> objectGroups;
+        std::vector<uint32_t> groupBases;
+    };
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
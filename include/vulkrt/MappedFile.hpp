@@ -0,0 +1,44 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "headers.hpp"
+
+namespace lve {
+
+    /**
+     * @brief Read-only memory mapping of a whole file.
+     *
+     * The mapping lives as long as the object; spans handed out by bytes() must not outlive it.
+     */
+    class MappedFile {
+    public:
+        MappedFile() noexcept = default;
+        explicit MappedFile(const fs::path &path);
+        ~MappedFile();
+
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+        MappedFile(MappedFile &&other) noexcept;
+        MappedFile &operator=(MappedFile &&other) noexcept;
+
+        [[nodiscard]] bool isOpen() const noexcept { return data_ != nullptr; }
+        [[nodiscard]] const std::byte *data() const noexcept { return data_; }
+        [[nodiscard]] std::size_t size() const noexcept { return size_; }
+        [[nodiscard]] std::span<const std::byte> bytes() const noexcept { return {data_, size_}; }
+
+    private:
+        void close() noexcept;
+
+        const std::byte *data_ = nullptr;
+        std::size_t size_ = 0;
+#ifdef _WIN32
+        void *fileHandle_ = nullptr;
+        void *mappingHandle_ = nullptr;
+#endif
+    };
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
@@ -0,0 +1,125 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "vulkanCheck.hpp"
+
+#include <mutex>
+
+namespace lve {
+
+    /**
+     * @brief A sub-range of a VkDeviceMemory handed out by MemoryAllocator.
+     *
+     * Host-visible memory is persistently mapped by the allocator, mapped then points at offset inside the mapping.
+     * Several allocations share the same VkDeviceMemory, so they must never be mapped with vkMapMemory directly.
+     */
+    struct Allocation {
+        static inline constexpr uint32_t DEDICATED = std::numeric_limits<uint32_t>::max();
+
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+        VkDeviceSize offset = 0;
+        VkDeviceSize size = 0;
+        void *mapped = nullptr;
+        uint32_t memoryType = 0;
+        uint32_t pool = 0;
+        uint32_t block = DEDICATED;
+
+        [[nodiscard]] bool isValid() const noexcept { return memory != VK_NULL_HANDLE; }
+        [[nodiscard]] bool isDedicated() const noexcept { return block == DEDICATED; }
+    };
+
+    /**
+     * @brief Block based device memory sub-allocator.
+     *
+     * Memory is reserved in large VkDeviceMemory blocks per memory type; each block keeps an offset-sorted free list
+     * that is searched best-fit and coalesced on free. Requests larger than half a block get a dedicated allocation.
+     * Linear resources (buffers) and optimal tiling images live in separate pools so bufferImageGranularity never has
+     * to be honoured between neighbours. Host-visible blocks are mapped once for their whole lifetime.
+     */
+    class MemoryAllocator {
+    public:
+        static inline constexpr VkDeviceSize DEFAULT_BLOCK_SIZE = VkDeviceSize{64} << 20;
+
+        struct Stats {
+            VkDeviceSize reservedBytes = 0;  ///< bytes held in VkDeviceMemory (blocks and dedicated)
+            VkDeviceSize usedBytes = 0;      ///< bytes handed out to live allocations
+            VkDeviceSize freeBytes = 0;      ///< free bytes inside blocks
+            VkDeviceSize largestFreeRange = 0;
+            uint32_t blockCount = 0;
+            uint32_t dedicatedCount = 0;
+            uint32_t allocationCount = 0;
+            uint32_t freeRangeCount = 0;
+
+            /// 0 when all free block memory is one contiguous range, towards 1 as it splinters
+            [[nodiscard]] double fragmentation() const noexcept {
+                return freeBytes == 0 ? 0.0 : 1.0 - C_D(largestFreeRange) / C_D(freeBytes);
+            }
+        };
+
+        MemoryAllocator(VkPhysicalDevice physicalDevice, VkDevice device, VkDeviceSize blockSize = DEFAULT_BLOCK_SIZE);
+        ~MemoryAllocator();
+
+        MemoryAllocator(const MemoryAllocator &) = delete;
+        MemoryAllocator &operator=(const MemoryAllocator &) = delete;
+        MemoryAllocator(MemoryAllocator &&) = delete;
+        MemoryAllocator &operator=(MemoryAllocator &&) = delete;
+
+        /**
+         * @brief Reserves memory satisfying requirements from a type that has all of properties.
+         * @param optimalImage true for VK_IMAGE_TILING_OPTIMAL images, false for buffers and linear images.
+         * @throws std::runtime_error when no memory type matches or the driver is out of memory.
+         */
+        [[nodiscard]] Allocation allocate(const VkMemoryRequirements &requirements, VkMemoryPropertyFlags properties, bool optimalImage);
+        void free(Allocation &allocation) noexcept;
+
+        /// offset and size are relative to the allocation, VK_WHOLE_SIZE flushes up to its end
+        VkResult flush(const Allocation &allocation, VkDeviceSize offset, VkDeviceSize size) const noexcept;
+        VkResult invalidate(const Allocation &allocation, VkDeviceSize offset, VkDeviceSize size) const noexcept;
+
+        [[nodiscard]] Stats stats() const;
+        void logStats() const;
+
+    private:
+        struct Range {
+            VkDeviceSize offset;
+            VkDeviceSize size;
+        };
+
+        struct Block {
+            VkDeviceMemory memory = VK_NULL_HANDLE;
+            VkDeviceSize size = 0;
+            std::byte *mapped = nullptr;
+            std::vector<Range> freeRanges{};  // sorted by offset, never adjacent
+            uint32_t allocationCount = 0;
+        };
+
+        // one pool per (memory type, linear/optimal), blocks released while empty keep their slot with a null memory
+        struct Pool {
+            std::vector<Block> blocks{};
+        };
+
+        [[nodiscard]] uint32_t findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties) const;
+        [[nodiscard]] bool isHostVisible(uint32_t memoryType) const noexcept;
+        [[nodiscard]] bool isNonCoherent(uint32_t memoryType) const noexcept;
+        [[nodiscard]] VkDeviceMemory allocateMemory(VkDeviceSize size, uint32_t memoryType, std::byte *&mapped);
+        [[nodiscard]] static bool tryAllocate(Block &block, VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize &offset) noexcept;
+        static void release(Block &block, Range range) noexcept;
+        [[nodiscard]] VkMappedMemoryRange mappedRange(const Allocation &allocation, VkDeviceSize offset, VkDeviceSize size) const noexcept;
+
+        VkDevice device;
+        VkPhysicalDeviceMemoryProperties memoryProperties{};
+        VkDeviceSize blockSize;
+        VkDeviceSize nonCoherentAtomSize;
+        std::vector<Pool> pools{};
+        VkDeviceSize dedicatedBytes = 0;
+        uint32_t dedicatedCount = 0;
+        VkDeviceSize usedBytes = 0;
+        uint32_t allocationCount = 0;
+        mutable std::mutex mutex{};
+    };
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
@@ -0,0 +1,99 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "MappedFile.hpp"
+#include "Model.hpp"
+
+namespace lve {
+
+    /**
+     * @brief Versioned binary cache of imported meshes.
+     *
+     * A cache file sits next to its source (`<source>.vkmesh`) and holds a MeshCacheHeader followed by the packed
+     * Model::Vertex array and the uint32_t index array. The header records the source path hash, size and mtime so a
+     * stale or foreign cache is detected and rebuilt instead of being loaded.
+     */
+    class MeshCache {
+    public:
+        static inline constexpr std::array<char, 4> MAGIC{'V', 'K', 'M', 'C'};
+        /// bumped whenever the cached data changes, 2 since ObjReader replaced tinyobj as the importer
+        static inline constexpr uint32_t VERSION = 2;
+        static inline constexpr std::string_view EXTENSION = ".vkmesh";
+
+        struct Header {
+            std::array<char, 4> magic{MAGIC};
+            uint32_t version{VERSION};
+            uint32_t vertexSize{sizeof(Model::Vertex)};
+            uint32_t indexSize{sizeof(uint32_t)};
+            uint64_t vertexCount{};
+            uint64_t indexCount{};
+            uint64_t sourceSize{};
+            int64_t sourceMtime{};
+            uint64_t sourcePathHash{};
+        };
+
+        /**
+         * @brief A validated, memory-mapped cache file.
+         *
+         * vertices() and indices() point straight into the mapping, so they stay valid only while the view is alive.
+         */
+        class View {
+        public:
+            [[nodiscard]] std::span<const Model::Vertex> vertices() const noexcept { return vertices_; }
+            [[nodiscard]] std::span<const uint32_t> indices() const noexcept { return indices_; }
+
+        private:
+            friend class MeshCache;
+
+            MappedFile file_;
+            std::span<const Model::Vertex> vertices_;
+            std::span<const uint32_t> indices_;
+        };
+
+        /**
+         * @brief CPU side mesh ready for upload, either mapped from the cache or freshly imported.
+         */
+        class Mesh {
+        public:
+            [[nodiscard]] std::span<const Model::Vertex> vertices() const noexcept {
+                return cached ? cached->vertices() : std::span<const Model::Vertex>{builder.vertices};
+            }
+            [[nodiscard]] std::span<const uint32_t> indices() const noexcept {
+                return cached ? cached->indices() : std::span<const uint32_t>{builder.indices};
+            }
+
+        private:
+            friend class MeshCache;
+
+            std::optional<View> cached{};
+            Model::Builder builder{};
+        };
+
+        [[nodiscard]] static fs::path cachePathFor(const fs::path &sourcePath);
+
+        /**
+         * @brief Maps the cache of sourcePath, or imports the source and refreshes the cache when there is no valid one.
+         * @throws std::runtime_error when the source cannot be imported.
+         */
+        [[nodiscard]] static Mesh load(const std::string &sourcePath);
+
+        /**
+         * @brief Maps the cache of sourcePath if it exists and still matches the source file.
+         * @return The mapped view, or std::nullopt when the cache is missing, stale or corrupt.
+         */
+        [[nodiscard]] static std::optional<View> open(const fs::path &sourcePath) noexcept;
+
+        /**
+         * @brief Writes the cache of sourcePath. Failures are logged and otherwise ignored.
+         */
+        static void store(const fs::path &sourcePath, std::span<const Model::Vertex> vertices, std::span<const uint32_t> indices) noexcept;
+
+    private:
+        [[nodiscard]] static Header makeHeader(const fs::path &sourcePath);
+    };
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
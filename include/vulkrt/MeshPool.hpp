@@ -0,0 +1,108 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "Buffer.hpp"
+#include "StagingRing.hpp"
+
+namespace lve {
+
+    /**
+     * @brief Shared vertex and index megabuffers that every pooled mesh is sub-allocated from.
+     *
+     * Keeping all geometry in one vertex and one index buffer lets a whole scene be drawn with a single bind and
+     * vkCmdDrawIndexedIndirect: each mesh is addressed through firstIndex/vertexOffset of its Range. Both buffers are
+     * device local with a fixed capacity, allocate() returns std::nullopt once a mesh does not fit so callers can fall
+     * back to dedicated buffers. Freed ranges are only reused after every frame that may still read them has completed,
+     * which endFrame() (called by the Renderer once per submitted frame) keeps track of.
+     */
+    class MeshPool {
+    public:
+        static inline constexpr uint32_t DEFAULT_VERTEX_CAPACITY = 1U << 20;
+        static inline constexpr uint32_t DEFAULT_INDEX_CAPACITY = 4U << 20;
+
+        struct Range {
+            uint32_t vertexOffset = 0;
+            uint32_t vertexCount = 0;
+            uint32_t firstIndex = 0;
+            uint32_t indexCount = 0;
+        };
+
+        struct Stats {
+            uint32_t vertexCapacity = 0;
+            uint32_t indexCapacity = 0;
+            uint32_t usedVertices = 0;
+            uint32_t usedIndices = 0;
+            uint32_t meshCount = 0;
+        };
+
+        MeshPool(Device &device, VkDeviceSize vertexStride, uint32_t vertexCapacity = DEFAULT_VERTEX_CAPACITY,
+                 uint32_t indexCapacity = DEFAULT_INDEX_CAPACITY);
+        ~MeshPool() = default;
+
+        MeshPool(const MeshPool &) = delete;
+        MeshPool &operator=(const MeshPool &) = delete;
+        MeshPool(MeshPool &&) = delete;
+        MeshPool &operator=(MeshPool &&) = delete;
+
+        /// reserves room for a mesh, std::nullopt when either buffer has no free range large enough
+        [[nodiscard]] std::optional<Range> allocate(uint32_t vertexCount, uint32_t indexCount);
+        /// the range stays reserved until every frame in flight at the time of the call has completed
+        void free(const Range &range);
+        /**
+         * @brief Queues the upload of a mesh into its range through the staging ring.
+         * @param vertices range.vertexCount vertices of vertexStride bytes each.
+         * @param indices range.indexCount indices, relative to the mesh's first vertex.
+         */
+        [[nodiscard]] UploadToken upload(const Range &range, const void *vertices, std::span<const uint32_t> indices);
+        /// marks the end of a submitted frame, ranges freed long enough ago become reusable
+        void endFrame();
+
+        /// binds the vertex megabuffer at binding 0 and the index megabuffer
+        void bind(VkCommandBuffer commandBuffer) const noexcept;
+
+        [[nodiscard]] VkBuffer vertexBuffer() const noexcept { return vertices->getBuffer(); }
+        [[nodiscard]] VkBuffer indexBuffer() const noexcept { return indices->getBuffer(); }
+        [[nodiscard]] Stats stats() const;
+
+    private:
+        struct Span {
+            uint32_t offset;
+            uint32_t count;
+        };
+
+        // offset-sorted, coalesced first-fit free list over [0, capacity) elements
+        class FreeList {
+        public:
+            explicit FreeList(uint32_t size) : capacity{size}, freeCount{size}, spans{Span{0, size}} {}
+            [[nodiscard]] bool allocate(uint32_t count, uint32_t &offset);
+            void release(Span span);
+            [[nodiscard]] uint32_t used() const noexcept { return capacity - freeCount; }
+
+        private:
+            uint32_t capacity;
+            uint32_t freeCount;
+            std::vector<Span> spans;
+        };
+
+        struct Retired {
+            Range range;
+            uint64_t frame;  // reusable once frameCounter passes this value
+        };
+
+        Device &lveDevice;
+        VkDeviceSize vertexStride;
+        std::unique_ptr<Buffer> vertices;
+        std::unique_ptr<Buffer> indices;
+        FreeList freeVertices;
+        FreeList freeIndices;
+        std::vector<Retired> retired{};
+        uint64_t frameCounter = 0;
+        uint32_t meshCount = 0;
+        mutable std::mutex mutex{};
+    };
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
@@ -6,6 +6,8 @@
 
 #include "Device.hpp"
 #include "Buffer.hpp"
+#include "MeshPool.hpp"
+#include "StagingRing.hpp"
 
 namespace lve {
 
@@ -24,26 +26,61 @@ namespace lve {
                 return position == other.position && color == other.color && normal == other.normal && uv == other.uv;
             }
         };
+        /// object space bounding volumes, computed once when the geometry is loaded
+        struct Bounds {
+            glm::vec3 min{};
+            glm::vec3 max{};
+            glm::vec4 sphere{};  ///< xyz center, w radius
+
+            [[nodiscard]] static Bounds fromVertices(std::span<const Vertex> vertices) noexcept;
+        };
+        /// per-instance vertex data read by instanced_shader.vert at locations 4-11, one mat4 column per location
+        struct InstanceData {
+            glm::mat4 modelMatrix{1.0F};
+            glm::mat4 normalMatrix{1.0F};
+
+            static VkVertexInputBindingDescription getBindingDescription(uint32_t binding);
+            static std::vector<VkVertexInputAttributeDescription> getAttributeDescriptions(uint32_t binding);
+        };
+        /// OBJ front end used by Builder::loadModel
+        enum class ObjLoader : std::uint8_t {
+            Streaming,  ///< ObjReader: mmap + from_chars, chunks parsed in parallel
+            TinyObj,    ///< tinyobjloader, kept as reference implementation
+        };
         struct Builder {
             std::vector<Vertex> vertices{};
             std::vector<uint32_t> indices{};
+            Bounds bounds{};
+
+            void loadModel(const std::string &filepath, ObjLoader loader = ObjLoader::Streaming);
 
-            void loadModel(const std::string &filepath);
+        private:
+            void loadModelTinyObj(const std::string &filepath);
         };
 
         Model(Device &device, const Builder &builder) noexcept;
-        ~Model() = default;
+        Model(Device &device, std::span<const Vertex> vertices, std::span<const uint32_t> indices) noexcept;
+        Model(Device &device, std::span<const Vertex> vertices, std::span<const uint32_t> indices, const Bounds &bounds) noexcept;
+        ~Model();
         Model(const Model &) = delete;
         Model &operator=(const Model &) = delete;
 
         static std::unique_ptr<Model> createModelFromFile(Device &device, const std::string &filepath);
 
-        void bind(VkCommandBuffer commandBuffer) noexcept;
-        void draw(VkCommandBuffer commandBuffer) const noexcept;
+        void bind(VkCommandBuffer commandBuffer) const noexcept;
+        void draw(VkCommandBuffer commandBuffer, uint32_t instanceCount = 1, uint32_t firstInstance = 0) const noexcept;
+        /// false while the vertex/index upload is still on its way, such models must not be drawn yet
+        [[nodiscard]] bool isReady() const noexcept { return lveDevice.staging().isReady(uploadToken); }
+        [[nodiscard]] const Bounds &bounds() const noexcept { return objectBounds; }
+        /// object space bounding sphere, xyz center and w radius
+        [[nodiscard]] const glm::vec4 &boundingSphere() const noexcept { return objectBounds.sphere; }
+        /// location inside the device's MeshPool, nullptr when the model has its own buffers (pool full or no indices)
+        [[nodiscard]] const MeshPool::Range *poolRange() const noexcept { return pooledRange ? &*pooledRange : nullptr; }
 
     private:
-        void createVertexBuffers(const std::vector<Vertex> &vertices);
-        void createIndexBuffers(const std::vector<uint32_t> &indices);
+        void createPooledBuffers(std::span<const Vertex> vertices, std::span<const uint32_t> indices);
+        void createVertexBuffers(std::span<const Vertex> vertices);
+        void createIndexBuffers(std::span<const uint32_t> indices);
 
         Device &lveDevice;
 
@@ -53,6 +90,10 @@ namespace lve {
         bool hasIndexBuffer = false;
         std::unique_ptr<Buffer> indexBuffer;
         uint32_t indexCount;
+
+        Bounds objectBounds;
+        std::optional<MeshPool::Range> pooledRange{};
+        UploadToken uploadToken{};
     };
 
 }  // namespace lve
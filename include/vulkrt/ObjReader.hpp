@@ -0,0 +1,38 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "Model.hpp"
+
+namespace lve {
+
+    /**
+     * @brief Streaming Wavefront OBJ reader producing deduplicated Model::Vertex/index data.
+     *
+     * The file is memory-mapped and parsed in place with std::from_chars; no per-line std::string and no intermediate
+     * shape lists are built. Large files are cut at line boundaries into chunks that are parsed on worker threads and
+     * stitched back in file order, so the result does not depend on the number of chunks.
+     *
+     * Supported statements are `v` (with optional vertex color), `vn`, `vt` and `f` (any of the `v`, `v/vt`, `v//vn`,
+     * `v/vt/vn` forms, negative indices, polygons fan-triangulated); everything else is skipped.
+     */
+    class ObjReader {
+    public:
+        struct Options {
+            /// parse chunks on worker threads
+            bool parallel = true;
+            /// files smaller than this are parsed as a single chunk
+            std::size_t minChunkBytes = std::size_t{1} << 20;
+        };
+
+        static void read(const fs::path &filepath, std::vector<Model::Vertex> &vertices, std::vector<uint32_t> &indices,
+                         const Options &options);
+        static void read(const fs::path &filepath, std::vector<Model::Vertex> &vertices, std::vector<uint32_t> &indices) {
+            read(filepath, vertices, indices, Options{});
+        }
+    };
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
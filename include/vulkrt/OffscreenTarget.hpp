@@ -0,0 +1,66 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "Device.hpp"
+
+namespace lve {
+
+    /**
+     * @brief Render target of the headless Renderer: one color + depth image set per frame in flight.
+     *
+     * Mirrors the part of SwapChain the Renderer uses, without a surface or a presentation engine: acquiring waits for
+     * the frame's fence and hands out the frame's own images, submitting signals that fence. The color images end the
+     * render pass in TRANSFER_SRC_OPTIMAL so they can be copied out for inspection.
+     */
+    class OffscreenTarget {
+    public:
+        static constexpr VkFormat COLOR_FORMAT = VK_FORMAT_B8G8R8A8_SRGB;
+
+        OffscreenTarget(Device &deviceRef, const VkExtent2D &extent, uint32_t framesInFlight);
+        ~OffscreenTarget();
+
+        OffscreenTarget(const OffscreenTarget &) = delete;
+        OffscreenTarget &operator=(const OffscreenTarget &) = delete;
+
+        DISABLE_WARNINGS_PUSH(26446)
+        [[nodiscard]] VkFramebuffer getFrameBuffer(int index) const noexcept { return frames[C_ST(index)].framebuffer; }
+        [[nodiscard]] VkImage getColorImage(int index) const noexcept { return frames[C_ST(index)].color; }
+        DISABLE_WARNINGS_POP()
+        [[nodiscard]] VkRenderPass getRenderPass() const noexcept { return renderPass; }
+        [[nodiscard]] VkExtent2D getExtent() const noexcept { return extent; }
+        [[nodiscard]] float extentAspectRatio() const noexcept { return C_F(extent.width) / C_F(extent.height); }
+        [[nodiscard]] uint32_t getFramesInFlight() const noexcept { return C_UI32T(frames.size()); }
+
+        /// waits until the GPU is done with the next frame's images, imageIndex receives the frame index
+        [[nodiscard]] VkResult acquireNextImage(uint32_t *imageIndex) const noexcept;
+        [[nodiscard]] VkResult submitCommandBuffers(const VkCommandBuffer *buffers, const uint32_t *imageIndex);
+
+    private:
+        struct Frame {
+            VkImage color = VK_NULL_HANDLE;
+            Allocation colorAllocation{};
+            VkImageView colorView = VK_NULL_HANDLE;
+            VkImage depth = VK_NULL_HANDLE;
+            Allocation depthAllocation{};
+            VkImageView depthView = VK_NULL_HANDLE;
+            VkFramebuffer framebuffer = VK_NULL_HANDLE;
+            VkFence inFlight = VK_NULL_HANDLE;
+        };
+
+        void createRenderPass();
+        void createFrame(Frame &frame);
+        [[nodiscard]] VkImageView createView(VkImage image, VkFormat format, VkImageAspectFlags aspect) const;
+
+        Device &device;
+        VkExtent2D extent;
+        VkFormat depthFormat;
+        VkRenderPass renderPass = VK_NULL_HANDLE;
+        std::vector<Frame> frames;
+        std::size_t currentFrame = 0;
+    };
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
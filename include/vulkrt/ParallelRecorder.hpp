@@ -0,0 +1,71 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "Device.hpp"
+#include "ThreadPool.hpp"
+
+namespace lve {
+
+    /**
+     * @brief Splits draw recording across threads into secondary command buffers.
+     *
+     * Every recording thread owns one command pool per frame in flight (Vulkan pools must not be used from two threads
+     * at once), with one secondary command buffer in each. record() hands contiguous chunks of the items to the threads,
+     * the calling thread takes the first one, and executes the secondaries in chunk order, so the draw order does not
+     * depend on the thread count. With a single thread everything is recorded on the calling thread.
+     */
+    class ParallelRecorder {
+    public:
+        /// what a secondary command buffer needs to continue a render pass
+        struct PassInfo {
+            VkRenderPass renderPass = VK_NULL_HANDLE;
+            VkFramebuffer framebuffer = VK_NULL_HANDLE;
+            VkExtent2D extent{};
+        };
+        /// records the items [begin, end) into commandBuffer
+        using RecordFn = std::function<void(VkCommandBuffer commandBuffer, std::size_t begin, std::size_t end)>;
+
+        /**
+         * @param framesInFlight Sets of command pools to cycle through, see Renderer::getFramesInFlight.
+         * @param threadCount Recording threads including the calling one, 0 uses one per hardware thread.
+         */
+        ParallelRecorder(Device &device, uint32_t framesInFlight, std::size_t threadCount = 0);
+        ~ParallelRecorder();
+
+        ParallelRecorder(const ParallelRecorder &) = delete;
+        ParallelRecorder &operator=(const ParallelRecorder &) = delete;
+
+        /**
+         * @brief Records count items through recordChunk and executes the result into primary.
+         *
+         * The render pass of primary must have been begun with VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS. Every
+         * secondary starts with the viewport and scissor of pass set, pipelines and descriptor sets are not inherited.
+         * Chunks are never smaller than minChunk items, so small counts use fewer threads.
+         */
+        void record(VkCommandBuffer primary, int frameIndex, const PassInfo &pass, std::size_t count, const RecordFn &recordChunk,
+                    std::size_t minChunk = 64);
+
+        [[nodiscard]] std::size_t threadCount() const noexcept { return threads; }
+
+    private:
+        struct Slot {
+            VkCommandPool pool = VK_NULL_HANDLE;
+            VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        };
+
+        void recordSlot(const Slot &slot, const VkCommandBufferInheritanceInfo &inheritance, const PassInfo &pass, std::size_t begin,
+                        std::size_t end, const RecordFn &recordChunk) const;
+
+        Device &lveDevice;
+        std::size_t threads;
+        std::vector<std::vector<Slot>> frames;  // [frame in flight][thread]
+        std::vector<VkCommandBuffer> executed;  // scratch for vkCmdExecuteCommands
+        // last member: the workers are joined before the slots they record into go away
+        std::unique_ptr<ThreadPool> workers;
+    };
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
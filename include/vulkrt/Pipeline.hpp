@@ -14,6 +14,8 @@ namespace lve {
         PipelineConfigInfo(const PipelineConfigInfo &) = delete;
         PipelineConfigInfo &operator=(const PipelineConfigInfo &) = delete;
 
+        std::vector<VkVertexInputBindingDescription> bindingDescriptions{};
+        std::vector<VkVertexInputAttributeDescription> attributeDescriptions{};
         VkPipelineViewportStateCreateInfo viewportInfo{};
         VkPipelineInputAssemblyStateCreateInfo inputAssemblyInfo{};
         VkPipelineRasterizationStateCreateInfo rasterizationInfo{};
@@ -38,10 +40,10 @@ namespace lve {
         void bind(VkCommandBuffer commandBuffer) const noexcept;
 
         static void defaultPipelineConfigInfo(PipelineConfigInfo &configInfo);
-
-    private:
+        /// reads a SPIR-V binary, shared with ComputePipeline
         static std::vector<char> readFile(const std::string &filename);
 
+    private:
         void createGraphicsPipeline(const std::string &vertFilepath, const std::string &fragFilepath, const PipelineConfigInfo &configInfo);
 
         void createShaderModule(const std::vector<char> &code, VkShaderModule *shaderModule) const;
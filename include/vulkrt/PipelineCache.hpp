@@ -0,0 +1,54 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "vulkanCheck.hpp"
+
+namespace lve {
+
+    /**
+     * @brief VkPipelineCache persisted to disk between runs.
+     *
+     * The blob is only handed to the driver when its header matches the running physical device (vendorID, deviceID
+     * and pipelineCacheUUID); otherwise the cache starts empty and is rewritten on save(). Saving goes through a
+     * temporary file and a rename, so a crash never leaves a truncated cache behind.
+     */
+    class PipelineCache {
+    public:
+        static inline constexpr std::string_view FILE_NAME = "vulkrt_pipeline.cache";
+
+        PipelineCache(VkDevice device, const VkPhysicalDeviceProperties &properties, fs::path path);
+        ~PipelineCache();
+
+        PipelineCache(const PipelineCache &) = delete;
+        PipelineCache &operator=(const PipelineCache &) = delete;
+        PipelineCache(PipelineCache &&) = delete;
+        PipelineCache &operator=(PipelineCache &&) = delete;
+
+        [[nodiscard]] VkPipelineCache handle() const noexcept { return cache; }
+
+        /// adds one pipeline creation to the startup cost logged by save(), pipelines are created on the render thread
+        void addCreationTime(long double nanoseconds) noexcept {
+            creationTime += nanoseconds;
+            ++creationCount;
+        }
+
+        /// writes the current cache contents to disk, failures are logged and otherwise ignored
+        void save() const noexcept;
+
+    private:
+        [[nodiscard]] std::vector<char> loadValidated() const;
+
+        VkDevice device;
+        VkPhysicalDeviceProperties properties;
+        fs::path path;
+        VkPipelineCache cache = VK_NULL_HANDLE;
+        bool warm = false;
+        long double creationTime = 0;  // nanoseconds
+        uint32_t creationCount = 0;
+    };
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
@@ -0,0 +1,75 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "Device.hpp"
+
+namespace lve {
+
+    /// CPU side cost of recording a pass, counted by the render system as it writes the commands
+    struct DrawCounters {
+        uint32_t draws = 0;
+        uint32_t pipelineBinds = 0;
+        uint32_t descriptorBinds = 0;  ///< vkCmdBindDescriptorSets calls
+        uint64_t pushConstantBytes = 0;
+
+        DrawCounters &operator+=(const DrawCounters &other) noexcept {
+            draws += other.draws;
+            pipelineBinds += other.pipelineBinds;
+            descriptorBinds += other.descriptorBinds;
+            pushConstantBytes += other.pushConstantBytes;
+            return *this;
+        }
+    };
+
+    /**
+     * @brief One VK_QUERY_TYPE_PIPELINE_STATISTICS query per frame in flight around a stretch of draws.
+     *
+     * reset() must be recorded outside the render pass before begin()/end() inside it; it first reads the slot's previous
+     * results without waiting, so last() lags the CPU by the frames in flight. Needs the pipelineStatisticsQuery device
+     * feature, without it every call is a no-op. The query cannot span secondary command buffers.
+     */
+    class PipelineStatistics {
+    public:
+        /// counters in the order the device writes them, see STATISTICS
+        struct Values {
+            uint64_t inputVertices = 0;
+            uint64_t inputPrimitives = 0;
+            uint64_t vertexInvocations = 0;
+            uint64_t clippingInvocations = 0;
+            uint64_t clippingPrimitives = 0;
+            uint64_t fragmentInvocations = 0;
+        };
+
+        PipelineStatistics(Device &device, uint32_t framesInFlight);
+        ~PipelineStatistics();
+
+        PipelineStatistics(const PipelineStatistics &) = delete;
+        PipelineStatistics &operator=(const PipelineStatistics &) = delete;
+
+        [[nodiscard]] bool isEnabled() const noexcept { return queryPool != VK_NULL_HANDLE; }
+
+        void reset(VkCommandBuffer commandBuffer, uint32_t frameIndex);
+        /// ignored unless reset() was recorded for frameIndex since its last end()
+        void begin(VkCommandBuffer commandBuffer, uint32_t frameIndex) noexcept;
+        void end(VkCommandBuffer commandBuffer, uint32_t frameIndex) noexcept;
+
+        /// the most recent frame read back
+        [[nodiscard]] const Values &last() const noexcept { return lastValues; }
+        /// frames read back so far
+        [[nodiscard]] uint64_t frames() const noexcept { return frameCount; }
+
+    private:
+        enum class SlotState : std::uint8_t { Idle, Reset, Active, Pending };
+
+        Device &lveDevice;
+        VkQueryPool queryPool = VK_NULL_HANDLE;
+        std::vector<SlotState> slots;
+        Values lastValues{};
+        uint64_t frameCount = 0;
+    };
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
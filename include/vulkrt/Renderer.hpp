@@ -3,53 +3,137 @@
 //
 
 #pragma once
+#include "Buffer.hpp"
+#include "Descriptors.hpp"
 #include "Device.hpp"
+#include "GpuProfiler.hpp"
+#include "OffscreenTarget.hpp"
+#include "ParallelRecorder.hpp"
 #include "SwapChain.hpp"
 #include "Window.hpp"
 
 namespace lve {
+    /**
+     * @brief Owns the swap chain and everything that is duplicated per frame in flight.
+     *
+     * A headless Renderer draws into an OffscreenTarget instead and presents nothing; the rest of the interface is the
+     * same, so render systems do not know the difference.
+     *
+     * The frames in flight (1 to SwapChain::MAX_FRAMES_IN_FLIGHT) are chosen at construction: one frame gives the
+     * lowest latency as the CPU waits for the GPU every frame, more frames let the CPU record ahead at the cost of
+     * latency and memory. Every per-frame resource a render system keeps must be sized from getFramesInFlight().
+     */
     class Renderer {
     public:
-        Renderer(Window &window, Device &device) noexcept;
+        /// resources of one frame in flight, reused once the frame's fence has signaled
+        struct FrameResources {
+            VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+            std::unique_ptr<Buffer> globalUbo;  // host visible, persistently mapped
+            VkDescriptorSet globalDescriptorSet = VK_NULL_HANDLE;
+        };
+
+        /// @throws std::runtime_error when framesInFlight is outside [1, SwapChain::MAX_FRAMES_IN_FLIGHT]
+        Renderer(Window &window, Device &device, uint32_t framesInFlight, VkPresentModeKHR presentMode, VkDeviceSize globalUboSize);
+        /// headless, renders into an OffscreenTarget of extent
+        Renderer(Device &device, const VkExtent2D &extent, uint32_t framesInFlight, VkDeviceSize globalUboSize);
         ~Renderer();
 
         Renderer(const Renderer &) = delete;
         Renderer &operator=(const Renderer &) = delete;
 
-        [[nodiscard]] VkRenderPass getSwapChainRenderPass() const noexcept { return lveSwapChain->getRenderPass(); }
-        [[nodiscard]] float getAspectRatio() const noexcept { return lveSwapChain->extentAspectRatio(); }
+        [[nodiscard]] VkRenderPass getSwapChainRenderPass() const noexcept {
+            return offscreen ? offscreen->getRenderPass() : lveSwapChain->getRenderPass();
+        }
+        [[nodiscard]] float getAspectRatio() const noexcept {
+            return offscreen ? offscreen->extentAspectRatio() : lveSwapChain->extentAspectRatio();
+        }
+        [[nodiscard]] bool isHeadless() const noexcept { return offscreen != nullptr; }
         [[nodiscard]] bool isFrameInProgress() const noexcept { return isFrameStarted; }
+        [[nodiscard]] uint32_t getFramesInFlight() const noexcept { return C_UI32T(frames.size()); }
+        /// the mode the swap chain presents with, see SwapChain for the fallbacks; IMMEDIATE when headless
+        [[nodiscard]] VkPresentModeKHR getPresentMode() const noexcept {
+            return lveSwapChain ? lveSwapChain->getPresentMode() : VK_PRESENT_MODE_IMMEDIATE_KHR;
+        }
+        /// the swap chain is recreated with mode by the next beginFrame, which then returns nullptr; ignored when headless
+        void setPresentMode(VkPresentModeKHR mode) noexcept;
+        /// layout of the set 0 every pipeline binds, a single uniform buffer of globalUboSize bytes
+        [[nodiscard]] VkDescriptorSetLayout getGlobalSetLayout() const noexcept { return globalSetLayout->getDescriptorSetLayout(); }
 
         DISABLE_WARNINGS_PUSH(26446)
         [[nodiscard]] VkCommandBuffer getCurrentCommandBuffer() const noexcept {
             assert(isFrameStarted && "Cannot get command buffer when frame not in progress");
-            return commandBuffers[currentFrameIndex];
+            return frames[C_ST(currentFrameIndex)].commandBuffer;
+        }
+
+        [[nodiscard]] FrameResources &getCurrentFrame() noexcept {
+            assert(isFrameStarted && "Cannot get frame resources when frame not in progress");
+            return frames[C_ST(currentFrameIndex)];
         }
         DISABLE_WARNINGS_POP()
 
+        /// frames begun since construction, the current one included
+        [[nodiscard]] uint64_t getFrameNumber() const noexcept { return frameNumber; }
+        /// false when the graphics queue cannot write timestamps, the profiler then measures nothing
+        [[nodiscard]] bool hasGpuTimestamps() const noexcept { return gpuProfiler.isEnabled(); }
+        /**
+         * @brief GPU times of the current frame's scopes.
+         *
+         * The whole command buffer is the "frame" scope and the swap chain render pass the "render pass" scope; render
+         * systems add their own with GpuProfiler::Scope on the frame's command buffer.
+         */
+        [[nodiscard]] GpuProfiler &getGpuProfiler() noexcept { return gpuProfiler; }
+        /// see GpuProfiler::takeFrameTimes
+        [[nodiscard]] std::vector<GpuProfiler::FrameTime> takeGpuFrameTimes(bool afterIdle = false) {
+            return gpuProfiler.takeFrameTimes(afterIdle);
+        }
+
         [[nodiscard]] int getFrameIndex() const noexcept {
             assert(isFrameStarted && "Cannot get frame index when frame not in progress");
             return currentFrameIndex;
         }
 
+        /**
+         * @brief Acquires the next image and begins the command buffer of the next frame-in-flight slot.
+         *
+         * Acquiring waits for the slot's fence, so once beginFrame returns the GPU has finished the previous frame
+         * recorded in that slot: every per-slot resource (indexed by getFrameIndex()) can be read back, rewritten or
+         * replaced without further synchronization.
+         * @return nullptr when the swap chain had to be recreated, the frame is skipped then.
+         */
         [[nodiscard]] VkCommandBuffer beginFrame();
         void endFrame();
-        void beginSwapChainRenderPass(VkCommandBuffer commandBuffer) noexcept;
+        /// with VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS the viewport and scissor are left to the secondaries
+        void beginSwapChainRenderPass(VkCommandBuffer commandBuffer, VkSubpassContents contents = VK_SUBPASS_CONTENTS_INLINE) noexcept;
+        /// render pass, framebuffer and extent of the current frame, for recording secondary command buffers
+        [[nodiscard]] ParallelRecorder::PassInfo getPassInfo() const noexcept;
         void endSwapChainRenderPass(VkCommandBuffer commandBuffer) noexcept;
 
     private:
         void createCommandBuffers();
         void freeCommandBuffers() noexcept;
+        void createGlobalResources(VkDeviceSize globalUboSize);
         void recreateSwapChain();
+        [[nodiscard]] VkExtent2D targetExtent() const noexcept;
+        [[nodiscard]] VkFramebuffer targetFramebuffer() const noexcept;
 
-        Window &lveWindow;
+        Window *lveWindow;  // nullptr when headless
         Device &lveDevice;
         std::unique_ptr<SwapChain> lveSwapChain;
-        std::vector<VkCommandBuffer> commandBuffers;
+        std::unique_ptr<OffscreenTarget> offscreen;
+        VkPresentModeKHR requestedPresentMode;
+        bool presentModeChanged = false;
+        // note: order of declarations matters, the frames' descriptor sets come from globalPool
+        std::unique_ptr<DescriptorSetLayout> globalSetLayout;
+        std::unique_ptr<DescriptorPool> globalPool;
+        std::vector<FrameResources> frames;
+        GpuProfiler gpuProfiler;
+        uint32_t renderPassScope;
+        uint32_t renderPassQuery = GpuProfiler::INVALID_SCOPE;
 
-        uint32_t currentImageIndex;
-        int currentFrameIndex;
-        bool isFrameStarted;
+        uint64_t frameNumber = 0;
+        uint32_t currentImageIndex = 0;
+        int currentFrameIndex = 0;
+        bool isFrameStarted = false;
     };
 
 }  // namespace lve
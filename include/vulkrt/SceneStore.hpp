@@ -0,0 +1,140 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "GameObject.hpp"
+
+namespace lve {
+
+    /**
+     * @brief Dense structure-of-arrays storage for the objects of a scene.
+     *
+     * Objects keep the id handed out by GameObject::createGameObject(); a sparse set maps ids to dense indices. The
+     * components live in parallel arrays where index i of every array belongs to the same object, so per-frame passes
+     * (transform updates, culling, draw preparation) walk contiguous memory instead of hash nodes. erase() moves the
+     * last object into the freed slot, so dense indices are only stable until the next erase().
+     *
+     * Transforms are changed through the setters, which mark the object dirty. updateMatrices() recomputes the cached
+     * model/normal matrices of the dirty objects only, so static objects cost nothing per frame. Every change is stamped
+     * with a store-wide counter so consumers that keep copies (e.g. GPU buffers per frame in flight) can rewrite just
+     * what changed since their last upload.
+     *
+     * Objects can be parented with setParent(); their transform is then relative to the parent. The hierarchy is kept
+     * as preorder arrays (parents before children, every subtree contiguous), so world matrices are propagated in one
+     * linear pass over the subtrees of the dirty objects. The preorder is rebuilt by the first updateMatrices() after an
+     * insert, erase or setParent.
+     */
+    class SceneStore {
+    public:
+        using id_t = GameObject::id_t;
+        using stamp_t = std::uint64_t;
+        static inline constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+        static inline constexpr id_t NO_PARENT = std::numeric_limits<id_t>::max();
+
+        /// moves the components of object into the store under its id, replacing an object with the same id
+        void insert(GameObject &&object);
+        /// the children of id become roots and keep their local transform; @return false when id is not stored
+        bool erase(id_t id) noexcept;
+        void clear() noexcept;
+
+        [[nodiscard]] bool contains(id_t id) const noexcept { return indexOf(id) != INVALID_INDEX; }
+        /// dense index of id, INVALID_INDEX when it is not stored
+        [[nodiscard]] uint32_t indexOf(id_t id) const noexcept { return id < sparse.size() ? sparse[id] : INVALID_INDEX; }
+        [[nodiscard]] std::size_t size() const noexcept { return dense.size(); }
+        [[nodiscard]] bool empty() const noexcept { return dense.empty(); }
+
+        /// sets the model of id, does nothing when the object is gone (e.g. a streamed model arriving late)
+        void setModel(id_t id, std::shared_ptr<Model> model) noexcept;
+        // transform setters, they do nothing when id is not stored
+        void setTranslation(id_t id, const glm::vec3 &translation) noexcept;
+        void setRotation(id_t id, const glm::vec3 &rotation) noexcept;
+        void setScale(id_t id, const glm::vec3 &scale) noexcept;
+        void setTransform(id_t id, const TransformComponent &transform) noexcept;
+        /**
+         * @brief Makes the transform of child relative to parent, NO_PARENT makes child a root again.
+         * @return false when an id is not stored or parent is child itself or one of its descendants.
+         */
+        bool setParent(id_t child, id_t parent) noexcept;
+        /// NO_PARENT for roots and ids that are not stored
+        [[nodiscard]] id_t parentOf(id_t id) const noexcept;
+
+        /**
+         * @brief Recomputes the local matrices of the objects changed since the last call in one TransformKernel batch,
+         * then the world matrices of their subtrees.
+         * @return Number of world matrices recomputed.
+         */
+        std::size_t updateMatrices();
+
+        // dense component arrays, all of size()
+        [[nodiscard]] std::span<const id_t> ids() const noexcept { return dense; }
+        [[nodiscard]] std::span<const glm::vec3> translations() const noexcept { return translations_; }
+        [[nodiscard]] std::span<const glm::vec3> rotations() const noexcept { return rotations_; }
+        [[nodiscard]] std::span<const glm::vec3> scales() const noexcept { return scales_; }
+        [[nodiscard]] std::span<glm::vec3> colors() noexcept { return colors_; }
+        [[nodiscard]] std::span<const glm::vec3> colors() const noexcept { return colors_; }
+        [[nodiscard]] std::span<const std::shared_ptr<Model>> models() const noexcept { return models_; }
+        /// cached world matrices, current as of the last updateMatrices()
+        [[nodiscard]] std::span<const glm::mat4> modelMatrices() const noexcept { return modelMatrices_; }
+        [[nodiscard]] std::span<const glm::mat4> normalMatrices() const noexcept { return normalMatrices_; }
+
+        /// stamp of the most recent change of any kind
+        [[nodiscard]] stamp_t stamp() const noexcept { return changeCounter; }
+        /// stamp of the most recent insert, erase or model change, i.e. anything that moves objects between indices or draws
+        [[nodiscard]] stamp_t structureStamp() const noexcept { return structureChange; }
+        /**
+         * @brief Every change stamped up to this value is reflected in modelMatrices(), as of the last updateMatrices().
+         * Consumers that copy the matrices record this, not stamp(): setter stamps taken after updateMatrices() belong
+         * to matrices that are not recomputed yet.
+         */
+        [[nodiscard]] stamp_t matricesStamp() const noexcept { return matricesChange; }
+        /// stamp of the most recent change of the world matrix of the object at index
+        [[nodiscard]] stamp_t transformStamp(uint32_t index) const noexcept { return transformStamps[index]; }
+
+    private:
+        // preorder of the hierarchy, indexed by position unless noted
+        struct Hierarchy {
+            std::vector<uint32_t> index{};       // dense index of the object at each position
+            std::vector<uint32_t> parent{};      // parent position, INVALID_INDEX for roots
+            std::vector<uint32_t> subtreeEnd{};  // one past the last position of the subtree
+            std::vector<uint32_t> position{};    // by dense index
+            bool stale = false;
+        };
+
+        void markDirty(uint32_t index) noexcept;
+        void rebuildHierarchy();
+        /// world matrices of the positions [begin, end), parents first, stamped with stamp
+        void propagate(uint32_t begin, uint32_t end, stamp_t stamp) noexcept;
+
+        std::vector<uint32_t> sparse{};  // id -> dense index
+        std::vector<id_t> dense{};       // dense index -> id
+        std::vector<glm::vec3> translations_{};
+        std::vector<glm::vec3> rotations_{};
+        std::vector<glm::vec3> scales_{};
+        std::vector<glm::vec3> colors_{};
+        std::vector<std::shared_ptr<Model>> models_{};
+        std::vector<id_t> parents_{};
+        std::vector<glm::mat4> localMatrices{};
+        std::vector<glm::mat4> localNormals{};
+        std::vector<glm::mat4> modelMatrices_{};
+        std::vector<glm::mat4> normalMatrices_{};
+        std::vector<stamp_t> transformStamps{};
+        std::vector<uint8_t> dirty{};   // per dense index, guards against duplicates in dirtyIds
+        std::vector<id_t> dirtyIds{};  // ids survive erase() reordering, erased ones are skipped
+        stamp_t changeCounter = 0;
+        stamp_t structureChange = 0;
+        stamp_t matricesChange = 0;
+        Hierarchy hierarchy{};
+        // updateMatrices() scratch, kept to reuse its storage
+        std::vector<uint32_t> updateIndices{};
+        std::vector<glm::vec3> updateTranslations{};
+        std::vector<glm::vec3> updateRotations{};
+        std::vector<glm::vec3> updateScales{};
+        std::vector<glm::mat4> updateModels{};
+        std::vector<glm::mat4> updateNormals{};
+        std::vector<uint32_t> updatePositions{};
+    };
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
@@ -3,30 +3,91 @@
 //
 
 #pragma once
+#include "Buffer.hpp"
 #include "Camera.hpp"
 #include "Device.hpp"
+#include "FrustumCuller.hpp"
 #include "FrameInfo.hpp"
 #include "GameObject.hpp"
+#include "ParallelRecorder.hpp"
 #include "Pipeline.hpp"
+#include "PipelineStatistics.hpp"
+
+#include <mutex>
 
 namespace lve {
 
     class SimpleRenderSystem {
     public:
-        SimpleRenderSystem(Device &device, VkRenderPass renderPass, VkDescriptorSetLayout globalSetLayout);
+        enum class RenderMode : std::uint8_t {
+            PerObject,  ///< one push constant + draw per GameObject
+            Instanced,  ///< one draw per unique Model, matrices streamed through a per-frame instance buffer
+        };
+
+        /// framesInFlight sizes the per-frame instance buffers, see Renderer::getFramesInFlight
+        SimpleRenderSystem(Device &device, VkRenderPass renderPass, VkDescriptorSetLayout globalSetLayout, uint32_t framesInFlight,
+                           RenderMode mode = RenderMode::PerObject);
         ~SimpleRenderSystem();
 
         SimpleRenderSystem(const SimpleRenderSystem &) = delete;
         SimpleRenderSystem &operator=(const SimpleRenderSystem &) = delete;
 
+        /**
+         * @brief Instrumentation mode: renderGameObjects is wrapped in a pipeline statistics query, see PipelineStatistics.
+         * prepare() must then be called every frame before the render pass begins. Draw counters are always kept.
+         */
+        void setStatisticsEnabled(bool enabled);
+        /// resets the frame's statistics query, call before the render pass begins; does nothing when not instrumented
+        void prepare(const FrameInfo &frameInfo);
+        /// records the objects inside the camera frustum, the others are skipped before any command is written
         void renderGameObjects(FrameInfo& frameInfo);
+        /**
+         * @brief Same as renderGameObjects, recorded into secondary command buffers split across recorder's threads.
+         * The render pass must have been begun with VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS.
+         */
+        void renderGameObjects(FrameInfo &frameInfo, ParallelRecorder &recorder, const ParallelRecorder::PassInfo &pass);
+        /// ready objects tested / found visible by the last renderGameObjects
+        [[nodiscard]] const FrustumCuller::Stats &cullStats() const noexcept { return stats; }
+        /// commands recorded by the last renderGameObjects
+        [[nodiscard]] const DrawCounters &drawCounters() const noexcept { return counters; }
+        /// nullptr unless instrumented; the parallel path records no statistics as the query cannot span secondaries
+        [[nodiscard]] const PipelineStatistics *pipelineStatistics() const noexcept { return statistics.get(); }
+
     private:
+        struct DrawGroup {
+            Model *model;
+            uint32_t firstInstance;
+            uint32_t instanceCount;
+        };
+
         void createPipelineLayout(VkDescriptorSetLayout globalSetLayout);
         void createPipeline(VkRenderPass renderPass);
+        void cullGameObjects(const FrameInfo &frameInfo);
+        void bindPipeline(const FrameInfo &frameInfo, VkCommandBuffer commandBuffer, DrawCounters &drawCounters) const noexcept;
+        /// the visible objects [begin, end), only reads shared state so chunks can be recorded concurrently
+        void renderPerObject(const FrameInfo &frameInfo, VkCommandBuffer commandBuffer, std::size_t begin, std::size_t end,
+                             DrawCounters &drawCounters) const;
+        void renderInstanced(const FrameInfo &frameInfo, VkCommandBuffer commandBuffer, DrawCounters &drawCounters);
+        Buffer &instanceBufferFor(int frameIndex, std::size_t instanceCount);
 
         Device &lveDevice;
+        RenderMode mode;
 
         std::unique_ptr<Pipeline> lvePipeline;
         VkPipelineLayout pipelineLayout{};
+
+        // instanced mode: one host visible buffer per frame in flight, grown on demand
+        std::vector<std::unique_ptr<Buffer>> instanceBuffers;
+        std::unique_ptr<PipelineStatistics> statistics;
+        DrawCounters counters{};
+        std::mutex countersMutex;  // parallel chunks add their counts under it
+        // per-frame scratch, kept to reuse its storage
+        std::vector<uint32_t> candidates;  // scene indices of the ready objects
+        FrustumCuller::SphereBatch candidateSpheres;
+        std::vector<uint32_t> visibleObjects;  // indices into candidates
+        FrustumCuller::Stats stats{};
+        std::unordered_map<const Model *, uint32_t> groupIndex;
+        std::vector<DrawGroup> groups;
+        std::vector<uint32_t> objectGroups;
     };
-}  // namespace lve
\ No newline at end of file
+}  // namespace lve
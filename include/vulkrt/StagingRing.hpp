@@ -0,0 +1,123 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "Device.hpp"
+
+namespace lve {
+
+    /**
+     * @brief Completion token of a StagingRing upload.
+     *
+     * Serials grow monotonically; a token is ready once every batch up to its serial may be consumed by graphics work
+     * submitted afterwards. A default constructed token is always ready.
+     */
+    struct UploadToken {
+        uint64_t serial = 0;
+
+        [[nodiscard]] friend constexpr UploadToken max(UploadToken lhs, UploadToken rhs) noexcept {
+            return lhs.serial < rhs.serial ? rhs : lhs;
+        }
+    };
+
+    /**
+     * @brief Persistently mapped staging ring that batches buffer uploads and runs them on the transfer queue.
+     *
+     * upload() copies the data into the ring and records a vkCmdCopyBuffer into the open batch; nothing is submitted
+     * until flush() (called by the Renderer before every frame submit) or until the ring runs out of room. Uploads
+     * larger than the ring are split.
+     *
+     * On devices with a dedicated transfer family a batch is submitted to the transfer queue with queue family release
+     * barriers and signals a semaphore. Once its fence is seen signaled, a later flush() submits the matching acquire
+     * barriers on the graphics queue, waiting on that semaphore, so frames are never queued behind a copy. On the
+     * graphics queue fallback a single barrier at the end of the batch is enough. Concurrent destinations skip the
+     * ownership transfer; the semaphore wait of the acquire submit alone orders their copies before later frames. Either
+     * way the token returned by upload() becomes ready once graphics work submitted from then on is ordered after the data.
+     *
+     * Ring space is reclaimed in submission order when the copies complete. Destination buffers must stay alive until
+     * their token is ready and the frames using them have completed (or until waitIdle()). upload() and flush() may
+     * submit to the graphics queue, so they must run on the thread that submits frames.
+     */
+    class StagingRing {
+    public:
+        static inline constexpr VkDeviceSize DEFAULT_CAPACITY = VkDeviceSize{32} << 20;
+        static inline constexpr std::size_t BATCH_COUNT = 4;
+
+        explicit StagingRing(Device &device, VkDeviceSize capacity = DEFAULT_CAPACITY);
+        ~StagingRing();
+
+        StagingRing(const StagingRing &) = delete;
+        StagingRing &operator=(const StagingRing &) = delete;
+        StagingRing(StagingRing &&) = delete;
+        StagingRing &operator=(StagingRing &&) = delete;
+
+        /**
+         * @brief Queues a copy of size bytes from data into dstBuffer at dstOffset.
+         * @param dstBuffer Exclusive buffer owned by the graphics family, or a concurrent one from Device::createBuffer.
+         * @param dstStage Pipeline stages that will consume the data.
+         * @param dstAccess Access types that will consume the data.
+         * @param dstSharing VK_SHARING_MODE_CONCURRENT for buffers that graphics may read while the copy runs.
+         * @return Token of the batch that carries the last byte of the copy.
+         */
+        UploadToken upload(VkBuffer dstBuffer, VkDeviceSize dstOffset, const void *data, VkDeviceSize size,
+                           VkPipelineStageFlags dstStage, VkAccessFlags dstAccess, VkSharingMode dstSharing = VK_SHARING_MODE_EXCLUSIVE);
+
+        /// submits the open batch and hands finished transfers over to the graphics queue, never blocks
+        void flush();
+        /// submits the open batch and blocks until every batch has completed
+        void waitIdle();
+
+        [[nodiscard]] bool isReady(UploadToken token) const noexcept { return token.serial <= readySerial.load(std::memory_order_acquire); }
+        [[nodiscard]] bool usesTransferQueue() const noexcept { return dedicatedTransfer; }
+        [[nodiscard]] uint64_t submitCount() const noexcept { return submits; }
+
+    private:
+        enum class BatchState : std::uint8_t { Idle, Recording, Transferring, Acquiring };
+
+        struct Batch {
+            VkCommandBuffer transferCommands = VK_NULL_HANDLE;
+            VkCommandBuffer acquireCommands = VK_NULL_HANDLE;
+            VkFence transferFence = VK_NULL_HANDLE;
+            VkFence acquireFence = VK_NULL_HANDLE;
+            VkSemaphore transferDone = VK_NULL_HANDLE;
+            uint64_t serial = 0;
+            uint64_t ringEnd = 0;  // value of head once this batch's data was written
+            VkPipelineStageFlags dstStages = 0;
+            VkAccessFlags dstAccess = 0;
+            std::vector<VkBufferMemoryBarrier> ownershipBarriers{};
+            BatchState state = BatchState::Idle;
+        };
+
+        [[nodiscard]] VkDeviceSize reserve(VkDeviceSize size);
+        [[nodiscard]] Batch &openBatch();
+        void submit(Batch &batch);
+        void submitAcquire(Batch &batch);
+        void collect(bool wait);
+        void waitAcquire(Batch &batch);
+
+        Device &lveDevice;
+        VkDeviceSize capacity;
+        bool dedicatedTransfer;
+        uint32_t transferFamily;
+        uint32_t graphicsFamily;
+        VkBuffer buffer = VK_NULL_HANDLE;
+        Allocation allocation{};
+        std::byte *mapped = nullptr;
+        VkCommandPool transferPool = VK_NULL_HANDLE;
+        VkCommandPool acquirePool = VK_NULL_HANDLE;
+        std::array<Batch, BATCH_COUNT> batches{};
+        std::size_t current = 0;  // batch that is open or opens next
+        std::size_t oldest = 0;   // oldest batch whose copies may still be running
+        // monotonically increasing byte counters, position in the ring is counter % capacity
+        uint64_t head = 0;
+        uint64_t tail = 0;
+        uint64_t lastSerial = 0;
+        std::atomic<uint64_t> readySerial{0};
+        uint64_t submits = 0;
+        std::mutex mutex{};
+    };
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
@@ -6,10 +6,17 @@ namespace lve {
 
     class SwapChain {
     public:
-        static constexpr int MAX_FRAMES_IN_FLIGHT = 2;
-
-        SwapChain(Device &deviceRef, const VkExtent2D &windowExtent) noexcept;
-        SwapChain(Device &deviceRef, const VkExtent2D &windowExtent, std::shared_ptr<SwapChain> previous);
+        /// upper bound for the frames in flight, per-frame arrays sized statically can use it
+        static constexpr uint32_t MAX_FRAMES_IN_FLIGHT = 4;
+        static constexpr uint32_t DEFAULT_FRAMES_IN_FLIGHT = 2;
+
+        /**
+         * @param presentMode Requested mode; when the surface does not support it MAILBOX and IMMEDIATE fall back to each
+         * other (both present without waiting for vblank), everything else falls back to FIFO, which is always available.
+         */
+        SwapChain(Device &deviceRef, const VkExtent2D &windowExtent, uint32_t framesInFlight, VkPresentModeKHR presentMode) noexcept;
+        /// keeps the frames in flight of previous
+        SwapChain(Device &deviceRef, const VkExtent2D &windowExtent, std::shared_ptr<SwapChain> previous, VkPresentModeKHR presentMode);
         ~SwapChain();
 
         SwapChain(const SwapChain &) = delete;
@@ -20,6 +27,9 @@ namespace lve {
         [[nodiscard]] VkRenderPass getRenderPass() const noexcept { return renderPass; }
         [[nodiscard]] VkImageView getImageView(int index) const noexcept { return swapChainImageViews[index]; }
         [[nodiscard]] size_t imageCount() const noexcept { return swapChainImages.size(); }
+        [[nodiscard]] uint32_t getFramesInFlight() const noexcept { return framesInFlight; }
+        /// the mode actually in use, may differ from the requested one
+        [[nodiscard]] VkPresentModeKHR getPresentMode() const noexcept { return presentMode; }
         [[nodiscard]] VkFormat getSwapChainImageFormat() const noexcept { return swapChainImageFormat; }
         [[nodiscard]] VkExtent2D getSwapChainExtent() const noexcept { return swapChainExtent; }
         [[nodiscard]] uint32_t width() const noexcept { return swapChainExtent.width; }
@@ -58,13 +68,16 @@ namespace lve {
         VkRenderPass renderPass;
 
         std::vector<VkImage> depthImages;
-        std::vector<VkDeviceMemory> depthImageMemorys;
+        std::vector<Allocation> depthImageAllocations;
         std::vector<VkImageView> depthImageViews;
         std::vector<VkImage> swapChainImages;
         std::vector<VkImageView> swapChainImageViews;
 
         Device &device;
         VkExtent2D windowExtent;
+        uint32_t framesInFlight;
+        VkPresentModeKHR requestedPresentMode;
+        VkPresentModeKHR presentMode = VK_PRESENT_MODE_FIFO_KHR;
 
         VkSwapchainKHR swapChain;
         std::shared_ptr<SwapChain> oldSwapChain;
@@ -0,0 +1,53 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "headers.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace lve {
+
+    /**
+     * @brief Fixed size pool of worker threads draining a FIFO job queue.
+     *
+     * Jobs still queued when the pool is destroyed are dropped; jobs already running are waited for.
+     */
+    class ThreadPool {
+    public:
+        /// threadCount == 0 uses one thread per hardware thread minus the main thread
+        explicit ThreadPool(std::size_t threadCount = 0);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+        ThreadPool(ThreadPool &&) = delete;
+        ThreadPool &operator=(ThreadPool &&) = delete;
+
+        template <typename Job> void submit(Job &&job) {
+            {
+                const std::scoped_lock lock{mutex};
+                jobs.emplace_back(std::forward<Job>(job));
+            }
+            condition.notify_one();
+        }
+
+        [[nodiscard]] std::size_t threadCount() const noexcept { return workers.size(); }
+
+    private:
+        void workerLoop(const std::stop_token &stopToken);
+
+        std::mutex mutex{};
+        std::condition_variable_any condition{};
+        std::deque<std::function<void()>> jobs{};
+        // last member: the threads are joined before the queue they read goes away
+        std::vector<std::jthread> workers{};
+    };
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
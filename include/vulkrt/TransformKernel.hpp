@@ -0,0 +1,36 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "headers.hpp"
+
+namespace lve {
+
+    /**
+     * @brief Batch model/normal matrix computation for arrays of translation, rotation (YXZ euler) and scale.
+     *
+     * TransformComponent::mat4() and normalMatrix() each evaluate the six sines and cosines of the rotation. The batch
+     * kernel evaluates them once per object, for 8 (AVX2) or 4 (SSE2) objects per instruction with a polynomial sincos,
+     * and assembles both matrices from the shared terms. The instruction set is picked at compile time like
+     * FrustumCuller; objects past the last full lane group use std::sin/std::cos.
+     */
+    class TransformKernel {
+    public:
+        /**
+         * @brief Writes the model and normal matrix of every object.
+         * @param modelMatrices, normalMatrices Need room for translations.size() matrices; rotations and scales must have
+         * the same size as translations.
+         */
+        static void compute(std::span<const glm::vec3> translations, std::span<const glm::vec3> rotations,
+                            std::span<const glm::vec3> scales, glm::mat4 *modelMatrices, glm::mat4 *normalMatrices) noexcept;
+        /// TransformComponent::computeMat4/computeNormalMatrix per object, the reference for compute()
+        static void computeScalar(std::span<const glm::vec3> translations, std::span<const glm::vec3> rotations,
+                                  std::span<const glm::vec3> scales, glm::mat4 *modelMatrices, glm::mat4 *normalMatrices) noexcept;
+        /// name of the instruction set compute() was compiled for
+        [[nodiscard]] static std::string_view isa() noexcept;
+    };
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
+#include <string_view>
 
 namespace lve {
     static inline constexpr auto golden_ratio = 0x9e3779b9;
@@ -14,4 +16,15 @@ namespace lve {
         (hashCombine(seed, rest), ...);
     };
 
+    static inline constexpr std::uint64_t fnv_offset_basis = 0xcbf29ce484222325ULL;
+    static inline constexpr std::uint64_t fnv_prime = 0x100000001b3ULL;
+    // 64-bit FNV-1a, stable across runs and platforms (unlike std::hash)
+    [[nodiscard]] constexpr std::uint64_t fnv1a64(std::string_view str, std::uint64_t seed = fnv_offset_basis) noexcept {
+        for(const char chr : str) {
+            seed ^= static_cast<std::uint8_t>(chr);
+            seed *= fnv_prime;
+        }
+        return seed;
+    }
+
 }  // namespace lve
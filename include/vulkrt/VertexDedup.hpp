@@ -0,0 +1,91 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "Model.hpp"
+#include "VertexHashTable.hpp"
+
+namespace lve {
+
+    /**
+     * @brief Number of face corners handled by one dedup task.
+     *
+     * Chunks are cut at fixed positions of the corner stream, never from the thread count, which is what keeps the
+     * output identical no matter how many workers run.
+     */
+    static inline constexpr std::size_t DEDUP_CHUNK_SIZE = std::size_t{1} << 16;
+
+    /**
+     * @brief Deduplicates a stream of face corners into a vertex and an index buffer, in parallel.
+     *
+     * Every chunk builds a local table of its unique vertices in first-occurrence order; the local tables are then
+     * merged into the global one strictly in chunk order and the indices are remapped. Since each chunk preserves
+     * first-occurrence order and chunks are merged in stream order, the result is byte-identical to a sequential
+     * single pass over the corners.
+     *
+     * @param cornerCount Number of corners in the stream.
+     * @param fetch Callable `Model::Vertex(std::size_t corner)`; invoked concurrently, so it must not mutate shared state.
+     * @param vertices Receives the unique vertices (cleared first).
+     * @param indices Receives one index per corner (cleared first).
+     */
+    template <typename FetchVertex>
+    void deduplicateVertices(std::size_t cornerCount, FetchVertex &&fetch, std::vector<Model::Vertex> &vertices,
+                             std::vector<uint32_t> &indices) {
+        vertices.clear();
+        indices.clear();
+        if(cornerCount == 0) { return; }
+
+        struct Chunk {
+            std::size_t begin{};
+            std::size_t end{};
+            std::vector<Model::Vertex> unique{};
+            std::vector<uint32_t> local{};
+            std::vector<uint32_t> remap{};
+        };
+
+        const std::size_t chunkCount = (cornerCount + DEDUP_CHUNK_SIZE - 1) / DEDUP_CHUNK_SIZE;
+        std::vector<Chunk> chunks(chunkCount);
+        for(std::size_t i = 0; i < chunkCount; ++i) {
+            chunks[i].begin = i * DEDUP_CHUNK_SIZE;
+            chunks[i].end = std::min(cornerCount, chunks[i].begin + DEDUP_CHUNK_SIZE);
+        }
+
+        // 1. local dedup, one table per chunk, no shared state
+        std::for_each(std::execution::par, chunks.begin(), chunks.end(), [&fetch](Chunk &chunk) {
+            // meshes share most corners between faces, so unique vertices are typically well under half the corners
+            VertexHashTable table{(chunk.end - chunk.begin) / 2};
+            chunk.local.reserve(chunk.end - chunk.begin);
+            for(std::size_t corner = chunk.begin; corner < chunk.end; ++corner) {
+                const Model::Vertex vertex = fetch(corner);
+                const auto [index, inserted] = table.findOrInsert(vertex, C_UI32T(chunk.unique.size()));
+                if(inserted) { chunk.unique.emplace_back(vertex); }
+                chunk.local.emplace_back(index);
+            }
+        });
+
+        // 2. deterministic merge in chunk order
+        VertexHashTable global{chunks.front().unique.size() * chunkCount};
+        for(auto &chunk : chunks) {
+            chunk.remap.reserve(chunk.unique.size());
+            for(const auto &vertex : chunk.unique) {
+                const auto [index, inserted] = global.findOrInsert(vertex, C_UI32T(vertices.size()));
+                if(inserted) { vertices.emplace_back(vertex); }
+                chunk.remap.emplace_back(index);
+            }
+            chunk.unique = {};
+        }
+
+        // 3. remap local indices to global ones, chunks write disjoint ranges
+        indices.resize(cornerCount);
+        std::for_each(std::execution::par, chunks.begin(), chunks.end(), [&indices](Chunk &chunk) {
+            std::ranges::transform(chunk.local, indices.begin() + C_PTRDIFT(chunk.begin),
+                                   [&chunk](const uint32_t local) noexcept { return chunk.remap[local]; });
+            chunk.local = {};
+            chunk.remap = {};
+        });
+    }
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
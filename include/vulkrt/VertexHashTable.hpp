@@ -0,0 +1,120 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "Model.hpp"
+
+#include <bit>
+
+namespace lve {
+
+    /**
+     * @brief Flat open-addressing map from Model::Vertex to a vertex index.
+     *
+     * Keys are compared and hashed on their raw 44-byte representation, so +0.0f and -0.0f are distinct keys and a
+     * NaN matches an identical NaN; for mesh dedup both are what we want. Slots are stored inline (key, cached hash,
+     * value) with linear probing over a power-of-two capacity: one allocation, no per-vertex node, and
+     * findOrInsert() resolves a lookup and an insert with a single probe sequence.
+     */
+    class VertexHashTable {
+    public:
+        static inline constexpr std::size_t KEY_WORDS = sizeof(Model::Vertex) / sizeof(uint32_t);
+        static_assert(sizeof(Model::Vertex) == KEY_WORDS * sizeof(uint32_t), "Model::Vertex must not contain padding");
+        static_assert(std::is_trivially_copyable_v<Model::Vertex>, "Model::Vertex must be trivially copyable");
+
+        VertexHashTable() noexcept = default;
+        explicit VertexHashTable(std::size_t expectedSize) { reserve(expectedSize); }
+
+        /**
+         * @brief Makes room for expectedSize keys without rehashing.
+         */
+        void reserve(std::size_t expectedSize) {
+            std::size_t capacity = MIN_CAPACITY;
+            while(capacity * MAX_LOAD_NUM < expectedSize * MAX_LOAD_DEN) { capacity <<= 1U; }
+            if(capacity > slots.size()) { rehash(capacity); }
+        }
+
+        /**
+         * @brief Looks up vertex and inserts it with value newIndex if absent.
+         * @return The stored index and whether the vertex was inserted.
+         */
+        [[nodiscard]] std::pair<uint32_t, bool> findOrInsert(const Model::Vertex &vertex, uint32_t newIndex) {
+            if((count + 1) * MAX_LOAD_DEN > slots.size() * MAX_LOAD_NUM) [[unlikely]] {
+                rehash(slots.empty() ? MIN_CAPACITY : slots.size() * 2);
+            }
+            const uint32_t hash = hashVertex(vertex);
+            const std::size_t mask = slots.size() - 1;
+            for(std::size_t pos = hash & mask;; pos = (pos + 1) & mask) {
+                Slot &slot = slots[pos];
+                if(slot.value == EMPTY) {
+                    slot.key = vertex;
+                    slot.hash = hash;
+                    slot.value = newIndex;
+                    ++count;
+                    return {newIndex, true};
+                }
+                if(slot.hash == hash && std::memcmp(&slot.key, &vertex, sizeof(Model::Vertex)) == 0) { return {slot.value, false}; }
+            }
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept { return count; }
+        [[nodiscard]] std::size_t capacity() const noexcept { return slots.size(); }
+
+        /**
+         * @brief Hash of the raw vertex bits.
+         *
+         * Four independent multiply-rotate lanes consume the eleven 32-bit words, which the compiler keeps in vector
+         * registers, then fold into a murmur3 style finaliser.
+         */
+        [[nodiscard]] static uint32_t hashVertex(const Model::Vertex &vertex) noexcept {
+            std::array<uint32_t, KEY_WORDS> words{};
+            std::memcpy(words.data(), &vertex, sizeof(Model::Vertex));
+
+            std::array<uint32_t, 4> lanes{0x9E3779B1U, 0x85EBCA77U, 0xC2B2AE3DU, 0x27D4EB2FU};
+            for(std::size_t i = 0; i < KEY_WORDS; ++i) {
+                uint32_t &lane = lanes[i & 3U];
+                lane = std::rotl(lane + words[i] * PRIME2, 13) * PRIME1;
+            }
+            uint32_t hash = std::rotl(lanes[0], 1) + std::rotl(lanes[1], 7) + std::rotl(lanes[2], 12) + std::rotl(lanes[3], 18);
+            hash ^= hash >> 16;
+            hash *= 0x85EBCA6BU;
+            hash ^= hash >> 13;
+            hash *= 0xC2B2AE35U;
+            hash ^= hash >> 16;
+            return hash;
+        }
+
+    private:
+        static inline constexpr uint32_t EMPTY = std::numeric_limits<uint32_t>::max();
+        static inline constexpr uint32_t PRIME1 = 0x9E3779B1U;
+        static inline constexpr uint32_t PRIME2 = 0x85EBCA77U;
+        static inline constexpr std::size_t MIN_CAPACITY = 16;
+        // keep the load factor under 5/8, linear probing degrades quickly past that
+        static inline constexpr std::size_t MAX_LOAD_NUM = 5;
+        static inline constexpr std::size_t MAX_LOAD_DEN = 8;
+
+        struct Slot {
+            Model::Vertex key;
+            uint32_t hash{};
+            uint32_t value = EMPTY;
+        };
+
+        void rehash(std::size_t newCapacity) {
+            std::vector<Slot> old = std::exchange(slots, std::vector<Slot>(newCapacity));
+            const std::size_t mask = newCapacity - 1;
+            for(const Slot &slot : old) {
+                if(slot.value == EMPTY) { continue; }
+                std::size_t pos = slot.hash & mask;
+                while(slots[pos].value != EMPTY) { pos = (pos + 1) & mask; }
+                slots[pos] = slot;
+            }
+        }
+
+        std::vector<Slot> slots{};
+        std::size_t count = 0;
+    };
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
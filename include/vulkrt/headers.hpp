@@ -37,6 +37,7 @@ DISABLE_WARNINGS_PUSH(
 #include <memory>
 #include <memory_resource>
 #include <numbers>
+#include <numeric>
 #include <ostream>
 #include <optional>
 #include <print>
@@ -44,6 +45,7 @@ DISABLE_WARNINGS_PUSH(
 #include <ranges>
 #include <set>
 #include <source_location>
+#include <span>
 #include <sstream>
 #include <stack>
 #include <stdexcept>
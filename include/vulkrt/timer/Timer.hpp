@@ -8,6 +8,7 @@
 #include "../format.hpp"
 #include "../headers.hpp"
 #include "Times.hpp"
+#include "TraceProfiler.hpp"
 #include "timeFactors.hpp"
 // On GCC < 4.8, the following define is often missing. Since
 // this library only uses sleep_for, this should be safe
@@ -204,6 +205,7 @@ namespace vnd {
 
     /**
      * @brief Automatic Timer class that prints out the time upon destruction.
+     * While TraceProfiler is enabled the measured scope is also recorded on the trace timeline.
      */
     class AutoTimer : public Timer {
     public:
@@ -218,7 +220,14 @@ namespace vnd {
         /**
          * @brief Destructor for AutoTimer class that prints the time string.
          */
-        ~AutoTimer() { LINFO(to_string()); }
+        ~AutoTimer() {
+            if(TraceProfiler::isEnabled()) {
+                const auto end = TraceProfiler::clock::now();
+                const auto elapsed = ch::duration_cast<TraceProfiler::clock::duration>(nanolld{make_time()});
+                TraceProfiler::record(TraceProfiler::intern(title_), end - elapsed, end);
+            }
+            LINFO(to_string());
+        }
     };
 }  // namespace vnd
 
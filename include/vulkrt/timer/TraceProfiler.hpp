@@ -0,0 +1,78 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "../disableWarn.hpp"
+#include "../headers.hpp"
+
+namespace vnd {
+
+    /**
+     * @brief Process wide timeline of timed scopes, written as Chrome trace-event JSON (chrome://tracing, ui.perfetto.dev).
+     *
+     * Every thread records into its own ring of RING_CAPACITY events, so recording takes no lock: the owning thread is
+     * the only writer and publishes each event with a release store of the ring's write count. When a ring is full the
+     * oldest events are overwritten. Each scope is stored as one complete ("X") event holding its begin and duration.
+     * A thread's ring is allocated by its first recorded event, so threads that never record while tracing is enabled
+     * cost nothing. The rings outlive their threads, so the pool workers' events are still written after the pool is
+     * gone; rings of exited threads that hold no events are dropped by writeChromeTrace.
+     *
+     * Recording is off until setEnabled(true); a disabled scope costs one relaxed atomic load.
+     */
+    class TraceProfiler {
+    public:
+        using clock = ch::steady_clock;
+
+        static constexpr std::size_t RING_CAPACITY = std::size_t{1} << 16;  ///< events per thread
+
+        static void setEnabled(bool enabled) noexcept;
+        [[nodiscard]] static bool isEnabled() noexcept { return enabled.load(std::memory_order_relaxed); }
+
+        /// name must outlive the profiler, a string literal or the result of intern()
+        static void record(const char *name, clock::time_point begin, clock::time_point end) noexcept;
+        /// stable copy of name, for scopes whose name is built at run time; takes a lock, keep it off hot paths
+        [[nodiscard]] static const char *intern(std::string_view name);
+        /// label of the calling thread in the trace viewer; does not allocate the thread's ring
+        static void setThreadName(std::string_view name);
+
+        /**
+         * @brief Writes every thread's events, oldest first per thread, timestamps in microseconds since the first event.
+         * Threads may keep recording meanwhile; events overwritten while they are being copied are left out.
+         * @throws std::runtime_error when the file cannot be written.
+         * @return Number of events written.
+         */
+        static std::size_t writeChromeTrace(const fs::path &filepath);
+
+    private:
+        static inline std::atomic<bool> enabled{false};
+    };
+
+    /// records the enclosing scope with TraceProfiler when tracing is enabled
+    class TraceScope {
+    public:
+        explicit TraceScope(const char *name) noexcept
+          : name_{TraceProfiler::isEnabled() ? name : nullptr},
+            begin_{name_ != nullptr ? TraceProfiler::clock::now() : TraceProfiler::clock::time_point{}} {}
+        ~TraceScope() {
+            if(name_ != nullptr) { TraceProfiler::record(name_, begin_, TraceProfiler::clock::now()); }
+        }
+
+        TraceScope(const TraceScope &) = delete;
+        TraceScope &operator=(const TraceScope &) = delete;
+        TraceScope(TraceScope &&) = delete;
+        TraceScope &operator=(TraceScope &&) = delete;
+
+    private:
+        const char *name_;
+        TraceProfiler::clock::time_point begin_;
+    };
+
+}  // namespace vnd
+
+#define TRACE_SCOPE_CONCAT_IMPL(a, b) a##b
+#define TRACE_SCOPE_CONCAT(a, b) TRACE_SCOPE_CONCAT_IMPL(a, b)
+/// times the rest of the enclosing block as a TraceScope named name (a string literal)
+#define TRACE_SCOPE(name) const vnd::TraceScope TRACE_SCOPE_CONCAT(traceScope, __LINE__)(name)
+// NOLINTEND(*-include-cleaner)
@@ -0,0 +1,28 @@
+#version 450
+layout(location = 0) in vec3 position;
+layout(location = 1) in vec3 color;
+layout(location = 2) in vec3 normal;
+layout(location = 3) in vec2 uv;
+
+// per instance, binding 1
+layout(location = 4) in mat4 modelMatrix;
+layout(location = 8) in mat4 normalMatrix;
+
+layout(location = 0) out vec3 fragColor;
+layout(location = 1) out vec3 fragPosWorld;
+layout(location = 2) out vec3 fragNormalWorld;
+
+layout(set = 0, binding = 0) uniform GlobalUbo {
+  mat4 projectionViewMatrix;
+  vec4 ambientLightColor; // w is intensity
+  vec3 lightPosition;
+  vec4 lightColor;
+} ubo;
+
+void main() {
+  vec4 positionWorld = modelMatrix * vec4(position, 1.0);
+  gl_Position = ubo.projectionViewMatrix * positionWorld;
+  fragNormalWorld = normalize(mat3(normalMatrix) * normal);
+  fragPosWorld = positionWorld.xyz;
+  fragColor = color;
+}
@@ -4,10 +4,11 @@
 // NOLINTBEGIN(*-include-cleaner)
 #include "vulkrt/App.hpp"
 
-#include "vulkrt/Buffer.hpp"
 #include "vulkrt/KeyboardMovementController.hpp"
+#include "vulkrt/IndirectRenderSystem.hpp"
 #include "vulkrt/SimpleRenderSystem.hpp"
 #include <vulkrt/FPSCounter.hpp>
+#include <vulkrt/timer/Timer.hpp>
 
 namespace lve {
 
@@ -22,98 +23,224 @@ namespace lve {
 
     static inline constexpr auto GLOBAL_UBO_SIZE = sizeof(GlobalUbo);
 
+    static std::string describeDrawStats(const SimpleRenderSystem &system) {
+        const DrawCounters &counters = system.drawCounters();
+        std::string text = FORMAT("{} draws, {} pipeline binds, {} descriptor binds, {} B push constants", counters.draws,
+                                  counters.pipelineBinds, counters.descriptorBinds, counters.pushConstantBytes);
+        if(const PipelineStatistics *statistics = system.pipelineStatistics(); statistics != nullptr && statistics->frames() > 0) {
+            const PipelineStatistics::Values &values = statistics->last();
+            text += FORMAT(" | {} vertices, {} primitives, {} clipped primitives, {} fragments", values.inputVertices,
+                           values.inputPrimitives, values.clippingPrimitives, values.fragmentInvocations);
+        }
+        return text;
+    }
+
     DISABLE_WARNINGS_PUSH(26432 26447)
-    App::App() noexcept {
-        globalPool = DescriptorPool::Builder(lveDevice)
-                         .setMaxSets(SwapChain::MAX_FRAMES_IN_FLIGHT)
-                         .addPoolSize(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, SwapChain::MAX_FRAMES_IN_FLIGHT)
-                         .build();
+    App::App(const AppConfig &appConfig)
+      : config{appConfig}, lveWindow{config.headless ? nullptr : MAKE_UNIQUE(Window, WWIDTH, WHEIGHT, WTITILE)},
+        lveRenderer{lveWindow ? MAKE_UNIQUE(Renderer, *lveWindow, lveDevice, config.framesInFlight, config.presentMode, GLOBAL_UBO_SIZE)
+                              : MAKE_UNIQUE(Renderer, lveDevice, VkExtent2D{C_UI32T(WWIDTH), C_UI32T(WHEIGHT)}, config.framesInFlight,
+                                            GLOBAL_UBO_SIZE)},
+        framePacer{config.targetFps} {
         loadGameObjects();
+        if(!config.cameraPath.empty()) { cameraPath = BenchmarkScene::load(config.cameraPath).cameraPath; }
     }
     DISABLE_WARNINGS_POP()
 
     DISABLE_WARNINGS_PUSH(26446)
     void App::run() {
-        std::vector<std::unique_ptr<Buffer>> uboBuffers(SwapChain::MAX_FRAMES_IN_FLIGHT);
-        std::ranges::for_each(uboBuffers, [&](auto &buffer) {
-            buffer = MAKE_UNIQUE(Buffer, lveDevice, GLOBAL_UBO_SIZE, 1, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
-                                 VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
-            buffer->map();
-        });
-
-        auto globalSetLayout =
-            DescriptorSetLayout::Builder(lveDevice).addBinding(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_SHADER_STAGE_ALL_GRAPHICS).build();
-
-        std::vector<VkDescriptorSet> globalDescriptorSets(SwapChain::MAX_FRAMES_IN_FLIGHT);
-        for(int i = 0; i < globalDescriptorSets.size(); i++) {
-            const auto bufferInfo = uboBuffers[i]->descriptorInfo();
-            DescriptorWriter(*globalSetLayout, *globalPool).writeBuffer(0, &bufferInfo).build(globalDescriptorSets[i]);
+        std::optional<IndirectRenderSystem> indirectRenderSystem;
+        std::optional<SimpleRenderSystem> simpleRenderSystem;
+        if(config.renderSystem == AppConfig::RenderSystem::Indirect) {
+            indirectRenderSystem.emplace(lveDevice, lveRenderer->getSwapChainRenderPass(), lveRenderer->getGlobalSetLayout(),
+                                         lveRenderer->getFramesInFlight());
+        } else {
+            const auto mode = config.renderSystem == AppConfig::RenderSystem::Instanced ? SimpleRenderSystem::RenderMode::Instanced
+                                                                                        : SimpleRenderSystem::RenderMode::PerObject;
+            simpleRenderSystem.emplace(lveDevice, lveRenderer->getSwapChainRenderPass(), lveRenderer->getGlobalSetLayout(),
+                                       lveRenderer->getFramesInFlight(), mode);
+            simpleRenderSystem->setStatisticsEnabled(config.pipelineStatistics);
         }
-
-        SimpleRenderSystem simpleRenderSystem{lveDevice, lveRenderer.getSwapChainRenderPass(), globalSetLayout->getDescriptorSetLayout()};
+        std::optional<ParallelRecorder> recorder;
+        if(config.recordThreads > 0) { recorder.emplace(lveDevice, lveRenderer->getFramesInFlight(), config.recordThreads); }
         Camera camera{};
         auto viewerObject = GameObject::createGameObject();
         viewerObject.transform.translation.z = -2.5f;
         const KeyboardMovementController cameraController{};
 
-        FPSCounter fps_counter{lveWindow.getGLFWWindow(), WTITILE};
-        while(!lveWindow.shouldClose()) {
-            glfwPollEvents();
-            fps_counter.frameInTitle();
-            const auto frameTime = C_F(fps_counter.getFrameTime());
-
-            cameraController.moveInPlaneXZ(lveWindow.getGLFWWindow(), frameTime, viewerObject);
+        // a followed path is sampled at fixed steps so every run renders the same views
+        const bool followPath = !cameraPath.empty();
+        const double timestep = config.timestep > 0.0 || !followPath ? config.timestep : 1.0 / 60.0;
+        const bool reporting = !config.reportPath.empty();
+        const bool recording = !config.recordCameraPath.empty();
+        double simulatedTime = 0.0;  // seconds since the first measured frame
+        CameraPath recordedPath{};
+
+        FPSCounter fps_counter{lveWindow ? lveWindow->getGLFWWindow() : nullptr, WTITILE};
+        frameTimeStats.clear();
+        frameTimeStats.reserve(config.frameCount);
+        benchmarkReport = {};
+        if(reporting) { benchmarkReport.reserve(config.frameCount); }
+        const auto keepRunning = [this] {
+            const bool open = lveWindow == nullptr || !lveWindow->shouldClose();
+            return open && (config.frameCount == 0 || frameTimeStats.size() < config.frameCount);
+        };
+        while(keepRunning()) {
+            TRACE_SCOPE("frame");
+            {
+                TRACE_SCOPE("pace");
+                framePacer.wait();
+            }
+            if(lveWindow) { glfwPollEvents(); }
+            framePacer.markInput();
+            assetStreamer.update();
+            if(lveWindow) {
+                fps_counter.frameInTitle();
+            } else {
+                fps_counter.updateFPS();
+            }
+            // frames drawn while the scene is still streaming in are warm-up
+            const bool measured = assetStreamer.pendingCount() == 0;
+            const auto frameTime = timestep > 0.0 ? C_F(timestep) : C_F(fps_counter.getFrameTime());
+
+            if(followPath) {
+                const CameraPath::Keyframe view = cameraPath.sample(C_F(simulatedTime));
+                viewerObject.transform.translation = view.translation;
+                viewerObject.transform.rotation = view.rotation;
+            } else if(lveWindow) {
+                cameraController.moveInPlaneXZ(lveWindow->getGLFWWindow(), frameTime, viewerObject);
+            }
             camera.setViewYXZ(viewerObject.transform.translation, viewerObject.transform.rotation);
 
-            const float aspect = lveRenderer.getAspectRatio();
+            const float aspect = lveRenderer->getAspectRatio();
             camera.setPerspectiveProjection(glm::radians(50.f), aspect, 0.1f, 100.f);
 
-            if(auto commandBuffer = lveRenderer.beginFrame()) {
-                const int frameIndex = lveRenderer.getFrameIndex();
-                FrameInfo frameInfo{frameIndex, frameTime, commandBuffer, camera, globalDescriptorSets[frameIndex], gameObjects};
+            if(auto commandBuffer = lveRenderer->beginFrame()) {
+                // starts after the fence wait of beginFrame, which is GPU time
+                const vnd::Timer cpuTimer{"frame cpu"};
+                const int frameIndex = lveRenderer->getFrameIndex();
+                const uint64_t frameNumber = lveRenderer->getFrameNumber();
+                Renderer::FrameResources &frame = lveRenderer->getCurrentFrame();
+                FrameInfo frameInfo{frameIndex, frameTime, commandBuffer, camera, frame.globalDescriptorSet, scene};
 
                 // update
+                TRACE_SCOPE("render");
+                scene.updateMatrices();
                 GlobalUbo ubo{};
                 ubo.projectionView = camera.getProjection() * camera.getView();
-                uboBuffers[frameIndex]->writeToBuffer(&ubo);
-                uboBuffers[frameIndex]->flush();
+                frame.globalUbo->writeToBuffer(&ubo);
+                frame.globalUbo->flush();
 
                 // render
-                lveRenderer.beginSwapChainRenderPass(commandBuffer);
-                simpleRenderSystem.renderGameObjects(frameInfo);
-                lveRenderer.endSwapChainRenderPass(commandBuffer);
-                lveRenderer.endFrame();
+                GpuProfiler &gpuProfiler = lveRenderer->getGpuProfiler();
+                if(indirectRenderSystem) {
+                    const GpuProfiler::Scope gpuScope{gpuProfiler, commandBuffer, "indirect prepare"};
+                    indirectRenderSystem->prepare(frameInfo);
+                } else {
+                    simpleRenderSystem->prepare(frameInfo);
+                }
+                if(recorder) {
+                    // a subpass recorded from secondaries only takes vkCmdExecuteCommands, so no GPU scope around the draws
+                    lveRenderer->beginSwapChainRenderPass(commandBuffer, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+                    simpleRenderSystem->renderGameObjects(frameInfo, *recorder, lveRenderer->getPassInfo());
+                } else if(indirectRenderSystem) {
+                    lveRenderer->beginSwapChainRenderPass(commandBuffer);
+                    const GpuProfiler::Scope gpuScope{gpuProfiler, commandBuffer, "indirect draw"};
+                    indirectRenderSystem->renderGameObjects(frameInfo);
+                } else {
+                    lveRenderer->beginSwapChainRenderPass(commandBuffer);
+                    const GpuProfiler::Scope gpuScope{gpuProfiler, commandBuffer, "simple draw"};
+                    simpleRenderSystem->renderGameObjects(frameInfo);
+                }
+                lveRenderer->endSwapChainRenderPass(commandBuffer);
+                if(config.pipelineStatistics) { fps_counter.setDetail(describeDrawStats(*simpleRenderSystem)); }
+                const double cpuMs = C_D(cpuTimer.make_time()) * 1e-6;
+                const vnd::Timer submitTimer{"frame submit"};
+                lveRenderer->endFrame();
+                const double submitMs = C_D(submitTimer.make_time()) * 1e-6;
+                framePacer.markPresent();
+                if(measured) {
+                    const double frameMs = C_D(fps_counter.getFrameTime()) * 1000.0;
+                    frameTimeStats.add(frameMs);
+                    if(reporting) {
+                        benchmarkReport.add({.frame = frameNumber,
+                                             .time = simulatedTime,
+                                             .frameMs = frameMs,
+                                             .cpuMs = cpuMs,
+                                             .submitMs = submitMs});
+                    }
+                    if(recording) {
+                        recordedPath.add({C_F(simulatedTime), viewerObject.transform.translation, viewerObject.transform.rotation});
+                    }
+                    simulatedTime += C_D(frameTime);
+                }
+                for(const auto &[gpuFrame, gpuMs] : lveRenderer->takeGpuFrameTimes()) { benchmarkReport.setGpuTime(gpuFrame, gpuMs); }
             }
         }
 
         vkDeviceWaitIdle(lveDevice.device());
+        for(const auto &[gpuFrame, gpuMs] : lveRenderer->takeGpuFrameTimes(true)) { benchmarkReport.setGpuTime(gpuFrame, gpuMs); }
+        const auto &pacing = framePacer.stats();
+        LINFO("input to present: {:.3f} ms average, {:.3f} ms max over {} frames", pacing.averageLatencyMs, pacing.maxLatencyMs,
+              pacing.frames);
+        frameTimeStats.log(lveRenderer->isHeadless() ? "headless frame times" : "frame times");
+        lveRenderer->getGpuProfiler().log();
+        if(config.pipelineStatistics) { LINFO("last frame: {}", describeDrawStats(*simpleRenderSystem)); }
+        if(reporting) {
+            benchmarkReport.cpuStats().log("cpu frame times");
+            if(lveRenderer->hasGpuTimestamps()) { benchmarkReport.gpuStats().log("gpu frame times"); }
+            benchmarkReport.write(config.reportPath);
+        }
+        if(recording) {
+            recordedPath.save(config.recordCameraPath);
+            LINFO("camera path of {} frames written to {}", recordedPath.values().size(), config.recordCameraPath.string());
+        }
     }
     DISABLE_WARNINGS_POP()
 
     void App::loadGameObjects() {
+        if(!config.scenePath.empty()) {
+            loadBenchmarkScene();
+            return;
+        }
         const auto smooth_vase_path = Window::calculateRelativePathToSrcModels(curentP, "smooth_vase.obj").string();
         const auto flat_vase_path = Window::calculateRelativePathToSrcModels(curentP, "flat_vase.obj").string();
         const auto quad_path = Window::calculateRelativePathToSrcModels(curentP, "quad.obj").string();
-        std::shared_ptr<Model> lveModel = Model::createModelFromFile(lveDevice, flat_vase_path);
         auto flatVase = GameObject::createGameObject();
-        flatVase.model = lveModel;
+        streamModel(flatVase.get_id(), flat_vase_path);
         flatVase.transform.translation = {-.5f, .5f, 0.0f};
         flatVase.transform.scale = {3.f, 1.5f, 3.f};
-        gameObjects.emplace(flatVase.get_id(),std::move(flatVase));
+        scene.insert(std::move(flatVase));
 
-        lveModel = Model::createModelFromFile(lveDevice, smooth_vase_path);
         auto smoothVase = GameObject::createGameObject();
-        smoothVase.model = lveModel;
+        streamModel(smoothVase.get_id(), smooth_vase_path);
         smoothVase.transform.translation = {.5f, .5f, 0.0f};
         smoothVase.transform.scale = {3.f, 1.5f, 3.f};
-        gameObjects.emplace(smoothVase.get_id(), std::move(smoothVase));
+        scene.insert(std::move(smoothVase));
 
-        lveModel = Model::createModelFromFile(lveDevice, quad_path);
         auto floor = GameObject::createGameObject();
-        floor.model = lveModel;
+        streamModel(floor.get_id(), quad_path);
         floor.transform.translation = {0.f, .5f, 0.f};
         floor.transform.scale = {3.f, 1.f, 3.f};
-        gameObjects.emplace(floor.get_id(), std::move(floor));
+        scene.insert(std::move(floor));
+    }
+
+    void App::loadBenchmarkScene() {
+        BenchmarkScene benchmarkScene = BenchmarkScene::load(config.scenePath);
+        for(const BenchmarkScene::Object &object : benchmarkScene.objects) {
+            auto gameObject = GameObject::createGameObject();
+            streamModel(gameObject.get_id(), object.model.string());
+            gameObject.transform = object.transform;
+            scene.insert(std::move(gameObject));
+        }
+        cameraPath = std::move(benchmarkScene.cameraPath);
+    }
+
+    void App::streamModel(GameObject::id_t id, const std::string &filepath) {
+        // the object may be gone by the time the model arrives
+        assetStreamer.requestModel(filepath, [this, id](std::shared_ptr<Model> model) {
+            scene.setModel(id, std::move(model));
+        });
     }
 
 }  // namespace lve
@@ -0,0 +1,100 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/AppConfig.hpp"
+
+#include <charconv>
+
+namespace lve {
+    namespace {
+        template <typename T> T parseNumber(std::string_view name, std::string_view value, T min, T max) {
+            T result{};
+            const auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), result);
+            if(error != std::errc{} || end != value.data() + value.size() || result < min || result > max) [[unlikely]] {
+                throw std::runtime_error(FORMAT("{} expects a number in [{}, {}], got '{}'", name, min, max, value));
+            }
+            return result;
+        }
+
+        VkPresentModeKHR parsePresentMode(std::string_view value) {
+            static constexpr std::array<std::pair<std::string_view, VkPresentModeKHR>, 4> modes{{
+                {"fifo", VK_PRESENT_MODE_FIFO_KHR},
+                {"fifo-relaxed", VK_PRESENT_MODE_FIFO_RELAXED_KHR},
+                {"mailbox", VK_PRESENT_MODE_MAILBOX_KHR},
+                {"immediate", VK_PRESENT_MODE_IMMEDIATE_KHR},
+            }};
+            const auto mode = std::ranges::find(modes, value, &std::pair<std::string_view, VkPresentModeKHR>::first);
+            if(mode == modes.end()) [[unlikely]] {
+                throw std::runtime_error(FORMAT("--present-mode expects fifo, fifo-relaxed, mailbox or immediate, got '{}'", value));
+            }
+            return mode->second;
+        }
+
+        fs::path parsePath(std::string_view name, std::string_view value) {
+            if(value.empty()) [[unlikely]] { throw std::runtime_error(FORMAT("{} expects a file name", name)); }
+            return fs::path{value};
+        }
+
+        AppConfig::RenderSystem parseRenderSystem(std::string_view value) {
+            if(value == "simple") { return AppConfig::RenderSystem::Simple; }
+            if(value == "instanced") { return AppConfig::RenderSystem::Instanced; }
+            if(value == "indirect") { return AppConfig::RenderSystem::Indirect; }
+            throw std::runtime_error(FORMAT("--render-system expects simple, instanced or indirect, got '{}'", value));
+        }
+    }  // namespace
+
+    AppConfig AppConfig::fromArgs(std::span<char *const> args) {
+        AppConfig config{};
+        for(const char *arg : args) {
+            const std::string_view option{arg};
+            const auto separator = option.find('=');
+            const std::string_view name = option.substr(0, separator);
+            const std::string_view value = separator == std::string_view::npos ? std::string_view{} : option.substr(separator + 1);
+            if(name == "--frames-in-flight") {
+                config.framesInFlight = parseNumber(name, value, 1U, SwapChain::MAX_FRAMES_IN_FLIGHT);
+            } else if(name == "--present-mode") {
+                config.presentMode = parsePresentMode(value);
+            } else if(name == "--target-fps") {
+                config.targetFps = parseNumber(name, value, 0.0, 10'000.0);
+            } else if(option == "--headless") {
+                config.headless = true;
+            } else if(name == "--frames") {
+                config.frameCount = parseNumber(name, value, 1U, std::numeric_limits<uint32_t>::max());
+            } else if(name == "--scene") {
+                config.scenePath = parsePath(name, value);
+            } else if(name == "--camera-path") {
+                config.cameraPath = parsePath(name, value);
+            } else if(name == "--record-camera") {
+                config.recordCameraPath = parsePath(name, value);
+            } else if(name == "--timestep") {
+                config.timestep = parseNumber(name, value, 0.0, 1.0);
+            } else if(name == "--report") {
+                config.reportPath = parsePath(name, value);
+            } else if(name == "--render-system") {
+                config.renderSystem = parseRenderSystem(value);
+            } else if(option == "--pipeline-stats") {
+                config.pipelineStatistics = true;
+            } else if(name == "--record-threads") {
+                config.recordThreads = parseNumber(name, value, 1U, MAX_RECORD_THREADS);
+            } else if(name == "--trace") {
+                config.tracePath = parsePath(name, value);
+            } else [[unlikely]] {
+                throw std::runtime_error(FORMAT("unknown option '{}'", option));
+            }
+        }
+        if(config.headless && config.frameCount == 0) { config.frameCount = DEFAULT_HEADLESS_FRAMES; }
+        if(config.pipelineStatistics && config.renderSystem == RenderSystem::Indirect) [[unlikely]] {
+            throw std::runtime_error("--pipeline-stats instruments SimpleRenderSystem, use --render-system=simple or instanced");
+        }
+        if(config.recordThreads > 0 && config.renderSystem == RenderSystem::Indirect) [[unlikely]] {
+            throw std::runtime_error("--record-threads records SimpleRenderSystem, use --render-system=simple or instanced");
+        }
+        if(config.recordThreads > 0 && config.pipelineStatistics) [[unlikely]] {
+            throw std::runtime_error("--pipeline-stats cannot be combined with --record-threads, a query cannot span secondaries");
+        }
+        return config;
+    }
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
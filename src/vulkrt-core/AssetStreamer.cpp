@@ -0,0 +1,77 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/AssetStreamer.hpp"
+#include "vulkrt/timer/TraceProfiler.hpp"
+
+namespace lve {
+
+    AssetStreamer::AssetStreamer(Device &device, std::size_t workerCount, std::size_t uploadBudget)
+      : lveDevice{device}, uploadBudget{uploadBudget}, workers{workerCount} {}
+
+    AssetStreamer::~AssetStreamer() {
+        // Models still uploading own buffers the transfer may be writing to
+        if(!uploading.empty()) { lveDevice.staging().waitIdle(); }
+    }
+
+    void AssetStreamer::requestModel(const std::string &filepath, ModelCallback onReady) {
+        if(const auto it = loaded.find(filepath); it != loaded.end()) {
+            if(auto model = it->second.lock()) {
+                onReady(std::move(model));
+                return;
+            }
+            loaded.erase(it);
+        }
+
+        auto &callbacks = waiting[filepath];
+        callbacks.emplace_back(std::move(onReady));
+        if(callbacks.size() > 1) { return; }
+
+        workers.submit([this, filepath] {
+            TRACE_SCOPE("import model");
+            Imported result{filepath};
+            try {
+                result.mesh = MeshCache::load(filepath);
+            } catch(const std::exception &e) { result.error = e.what(); }
+            const std::scoped_lock lock{importedMutex};
+            imported.emplace_back(std::move(result));
+        });
+    }
+
+    void AssetStreamer::update() {
+        TRACE_SCOPE("AssetStreamer::update");
+        std::size_t budget = uploadBudget;
+        while(budget > 0) {
+            Imported next{};
+            {
+                const std::scoped_lock lock{importedMutex};
+                if(imported.empty()) { break; }
+                next = std::move(imported.front());
+                imported.pop_front();
+            }
+            if(!next.mesh) [[unlikely]] {
+                LERROR("failed to load {}: {}", next.filepath, next.error);
+                waiting.erase(next.filepath);
+                continue;
+            }
+            const auto vertices = next.mesh->vertices();
+            const auto indices = next.mesh->indices();
+            budget -= std::min(budget, vertices.size_bytes() + indices.size_bytes());
+            uploading.emplace_back(Uploading{next.filepath, std::make_shared<Model>(lveDevice, vertices, indices)});
+        }
+
+        // the StagingRing flushes with every frame, hand models out once their data is usable
+        std::erase_if(uploading, [this](Uploading &entry) {
+            if(!entry.model->isReady()) { return false; }
+            loaded[entry.filepath] = entry.model;
+            const auto node = waiting.extract(entry.filepath);
+            if(!node.empty()) {
+                for(const auto &callback : node.mapped()) { callback(entry.model); }
+            }
+            return true;
+        });
+    }
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
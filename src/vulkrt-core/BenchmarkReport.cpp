@@ -0,0 +1,76 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/BenchmarkReport.hpp"
+
+namespace lve {
+    DISABLE_WARNINGS_PUSH(26446)
+    void BenchmarkReport::add(const Row &row) {
+        assert((rows.empty() || row.frame > rows.back().frame) && "report rows must be added in frame order");
+        rows.emplace_back(row);
+    }
+
+    void BenchmarkReport::setGpuTime(std::uint64_t frame, double gpuMs) noexcept {
+        const auto row = std::ranges::lower_bound(rows, frame, {}, &Row::frame);
+        if(row != rows.end() && row->frame == frame) { row->gpuMs = gpuMs; }
+    }
+
+    FrameTimeStats BenchmarkReport::cpuStats() const {
+        FrameTimeStats stats{};
+        stats.reserve(rows.size());
+        for(const Row &row : rows) { stats.add(row.cpuMs); }
+        return stats;
+    }
+
+    FrameTimeStats BenchmarkReport::gpuStats() const {
+        FrameTimeStats stats{};
+        stats.reserve(rows.size());
+        for(const Row &row : rows) {
+            if(row.gpuMs) { stats.add(*row.gpuMs); }
+        }
+        return stats;
+    }
+
+    void BenchmarkReport::writeCsv(std::ostream &out) const {
+        out << "frame,time_s,frame_ms,cpu_ms,submit_ms,gpu_ms\n";
+        for(const Row &row : rows) {
+            out << FORMAT("{},{:.6f},{:.4f},{:.4f},{:.4f},", row.frame, row.time, row.frameMs, row.cpuMs, row.submitMs);
+            if(row.gpuMs) { out << FORMAT("{:.4f}", *row.gpuMs); }
+            out << '\n';
+        }
+    }
+
+    void BenchmarkReport::writeJson(std::ostream &out) const {
+        const auto summary = [](const FrameTimeStats &stats) {
+            const auto s = stats.summarize();
+            return FORMAT(R"({{"frames": {}, "min": {:.4f}, "mean": {:.4f}, "p50": {:.4f}, "p95": {:.4f}, "p99": {:.4f}, "max": {:.4f}}})",
+                          s.frames, s.minMs, s.meanMs, s.p50Ms, s.p95Ms, s.p99Ms, s.maxMs);
+        };
+        out << "{\n";
+        out << R"(  "summary": {"cpu_ms": )" << summary(cpuStats()) << R"(, "gpu_ms": )" << summary(gpuStats()) << "},\n";
+        out << R"(  "frames": [)";
+        for(std::size_t i = 0; i < rows.size(); ++i) {
+            const Row &row = rows[i];
+            out << (i == 0 ? "\n" : ",\n");
+            out << FORMAT(R"(    {{"frame": {}, "time_s": {:.6f}, "frame_ms": {:.4f}, "cpu_ms": {:.4f}, "submit_ms": {:.4f}, "gpu_ms": )",
+                          row.frame, row.time, row.frameMs, row.cpuMs, row.submitMs);
+            out << (row.gpuMs ? FORMAT("{:.4f}", *row.gpuMs) : std::string{"null"}) << '}';
+        }
+        out << "\n  ]\n}\n";
+    }
+    DISABLE_WARNINGS_POP()
+
+    void BenchmarkReport::write(const fs::path &filepath) const {
+        std::ofstream out{filepath};
+        if(!out) [[unlikely]] { throw std::runtime_error(FORMAT("cannot write benchmark report {}", filepath.string())); }
+        if(filepath.extension() == ".json") {
+            writeJson(out);
+        } else {
+            writeCsv(out);
+        }
+        LINFO("benchmark report: {} frames written to {}", rows.size(), filepath.string());
+    }
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
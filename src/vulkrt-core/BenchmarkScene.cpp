@@ -0,0 +1,154 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/BenchmarkScene.hpp"
+#include "vulkrt/Window.hpp"
+
+#include <charconv>
+
+namespace lve {
+    namespace {
+        /// whitespace separated tokens of one statement, errors carry the statement's location
+        class Statement {
+        public:
+            Statement(std::string_view line, std::string location) noexcept : rest{line}, where{std::move(location)} {}
+
+            [[nodiscard]] bool hasMore() noexcept {
+                skipSpaces();
+                return !rest.empty();
+            }
+
+            [[nodiscard]] std::string_view word() {
+                skipSpaces();
+                if(rest.empty()) [[unlikely]] { fail("missing argument"); }
+                const auto end = std::min(rest.find_first_of(" \t\r"), rest.size());
+                const auto token = rest.substr(0, end);
+                rest.remove_prefix(end);
+                return token;
+            }
+
+            template <typename T> [[nodiscard]] T number() {
+                const auto token = word();
+                T value{};
+                const auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), value);
+                if(ec != std::errc{} || ptr != token.data() + token.size()) [[unlikely]] {
+                    fail(FORMAT("'{}' is not a number", token));
+                }
+                return value;
+            }
+
+            [[nodiscard]] glm::vec3 vec3() {
+                const auto x = number<float>();
+                const auto y = number<float>();
+                const auto z = number<float>();
+                return glm::vec3{x, y, z};
+            }
+
+            void expectEnd() {
+                if(hasMore()) [[unlikely]] { fail(FORMAT("unexpected '{}'", rest)); }
+            }
+
+            [[noreturn]] void fail(std::string_view message) const { throw std::runtime_error(FORMAT("{}: {}", where, message)); }
+
+        private:
+            void skipSpaces() noexcept { rest.remove_prefix(std::min(rest.find_first_not_of(" \t\r"), rest.size())); }
+
+            std::string_view rest;
+            std::string where;
+        };
+
+        fs::path resolveModel(const fs::path &sceneDir, std::string_view name) {
+            if(auto local = sceneDir / name; fs::exists(local)) { return local; }
+            return Window::calculateRelativePathToSrcModels(curentP, name);
+        }
+    }  // namespace
+
+    void CameraPath::add(const Keyframe &keyframe) {
+        if(!keyframes.empty() && keyframe.time < keyframes.back().time) [[unlikely]] {
+            throw std::runtime_error(FORMAT("camera keyframe at {}s comes after one at {}s", keyframe.time, keyframes.back().time));
+        }
+        keyframes.emplace_back(keyframe);
+    }
+
+    CameraPath::Keyframe CameraPath::sample(float time) const noexcept {
+        assert(!keyframes.empty() && "sampling an empty camera path");
+        const auto next = std::ranges::upper_bound(keyframes, time, {}, &Keyframe::time);
+        if(next == keyframes.begin()) { return keyframes.front(); }
+        if(next == keyframes.end()) { return keyframes.back(); }
+        const Keyframe &from = *std::prev(next);
+        const float span = next->time - from.time;
+        const float t = span > 0.F ? (time - from.time) / span : 1.F;
+        return Keyframe{.time = time,
+                        .translation = from.translation + (next->translation - from.translation) * t,
+                        .rotation = from.rotation + (next->rotation - from.rotation) * t};
+    }
+
+    void CameraPath::save(const fs::path &filepath) const {
+        std::ofstream out{filepath};
+        if(!out) [[unlikely]] { throw std::runtime_error(FORMAT("cannot write {}", filepath.string())); }
+        out << "# camera path, " << keyframes.size() << " keyframes\n";
+        for(const Keyframe &key : keyframes) {
+            out << FORMAT("camera {} {} {} {} {} {} {}\n", key.time, key.translation.x, key.translation.y, key.translation.z,
+                          key.rotation.x, key.rotation.y, key.rotation.z);
+        }
+    }
+
+    BenchmarkScene BenchmarkScene::load(const fs::path &filepath) {
+        std::ifstream in{filepath};
+        if(!in) [[unlikely]] { throw std::runtime_error(FORMAT("cannot open scene {}", filepath.string())); }
+        const fs::path sceneDir = filepath.parent_path();
+
+        BenchmarkScene scene{};
+        std::string line;
+        for(std::size_t lineNumber = 1; std::getline(in, line); ++lineNumber) {
+            std::string_view text{line};
+            text = text.substr(0, text.find('#'));
+            Statement statement{text, FORMAT("{}:{}", filepath.string(), lineNumber)};
+            if(!statement.hasMore()) { continue; }
+
+            const auto keyword = statement.word();
+            if(keyword == "object") {
+                Object object{.model = resolveModel(sceneDir, statement.word()), .transform = {}};
+                object.transform.translation = statement.vec3();
+                object.transform.rotation = statement.hasMore() ? statement.vec3() : glm::vec3{0.F};
+                if(statement.hasMore()) { object.transform.scale = statement.vec3(); }
+                statement.expectEnd();
+                scene.objects.emplace_back(std::move(object));
+            } else if(keyword == "grid") {
+                const fs::path model = resolveModel(sceneDir, statement.word());
+                const auto countX = statement.number<uint32_t>();
+                const auto countZ = statement.number<uint32_t>();
+                const auto spacing = statement.number<float>();
+                const float scale = statement.hasMore() ? statement.number<float>() : 1.F;
+                statement.expectEnd();
+                const float originX = -0.5F * spacing * C_F(countX > 0 ? countX - 1 : 0);
+                const float originZ = -0.5F * spacing * C_F(countZ > 0 ? countZ - 1 : 0);
+                scene.objects.reserve(scene.objects.size() + C_ST(countX) * countZ);
+                for(uint32_t z = 0; z < countZ; ++z) {
+                    for(uint32_t x = 0; x < countX; ++x) {
+                        Object object{.model = model, .transform = {}};
+                        object.transform.translation = glm::vec3{originX + spacing * C_F(x), 0.5F, originZ + spacing * C_F(z)};
+                        object.transform.rotation = glm::vec3{0.F};
+                        object.transform.scale = glm::vec3{scale};
+                        scene.objects.emplace_back(std::move(object));
+                    }
+                }
+            } else if(keyword == "camera") {
+                const auto time = statement.number<float>();
+                const auto translation = statement.vec3();
+                const auto rotation = statement.vec3();
+                statement.expectEnd();
+                try {
+                    scene.cameraPath.add(CameraPath::Keyframe{.time = time, .translation = translation, .rotation = rotation});
+                } catch(const std::runtime_error &e) { statement.fail(e.what()); }
+            } else [[unlikely]] {
+                statement.fail(FORMAT("unknown statement '{}'", keyword));
+            }
+        }
+        LINFO("scene {}: {} objects, {} camera keyframes", filepath.string(), scene.objects.size(), scene.cameraPath.values().size());
+        return scene;
+    }
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
@@ -23,24 +23,25 @@ namespace lve {
 
     DISABLE_WARNINGS_PUSH(26432)
     Buffer::Buffer(Device &device, VkDeviceSize instanceSize, uint32_t instanceCount, VkBufferUsageFlags usageFlags,
-                   VkMemoryPropertyFlags memoryPropertyFlags, VkDeviceSize minOffsetAlignment)
+                   VkMemoryPropertyFlags memoryPropertyFlags, VkDeviceSize minOffsetAlignment, VkSharingMode sharingMode)
       : lveDevice{device}, instanceCount{instanceCount}, instanceSize{instanceSize}, usageFlags{usageFlags},
         memoryPropertyFlags{memoryPropertyFlags} {
         alignmentSize = getAlignment(instanceSize, minOffsetAlignment);
         bufferSize = alignmentSize * instanceCount;
-        device.createBuffer(bufferSize, usageFlags, memoryPropertyFlags, buffer, memory);
+        device.createBuffer(bufferSize, usageFlags, memoryPropertyFlags, buffer, allocation, sharingMode);
     }
 
     Buffer::~Buffer() {
         unmap();
-        vkDestroyBuffer(lveDevice.device(), buffer, nullptr);
-        vkFreeMemory(lveDevice.device(), memory, nullptr);
+        lveDevice.destroyBuffer(buffer, allocation);
     }
     DISABLE_WARNINGS_POP()
 
     /**
      * Map a memory range of this buffer. If successful, mapped points to the specified buffer range.
      *
+     * @note Host visible memory is persistently mapped by the device allocator, this only hands out the pointer.
+     *
      * @param size (Optional) Size of the memory range to map. Pass VK_WHOLE_SIZE to map the complete
      * buffer range.
      * @param offset (Optional) Byte offset from beginning
@@ -48,21 +49,19 @@ namespace lve {
      * @return VkResult of the buffer mapping call
      */
     VkResult Buffer::map(VkDeviceSize size, VkDeviceSize offset) noexcept {
-        assert(buffer && memory && "Called map on buffer before create");
-        return vkMapMemory(lveDevice.device(), memory, offset, size, 0, &mapped);
+        assert(buffer && allocation.isValid() && "Called map on buffer before create");
+        if(allocation.mapped == nullptr) [[unlikely]] { return VK_ERROR_MEMORY_MAP_FAILED; }
+        assert((size == VK_WHOLE_SIZE || offset + size <= bufferSize) && "Mapped range exceeds the buffer");
+        mapped = static_cast<std::byte *>(allocation.mapped) + offset;
+        return VK_SUCCESS;
     }
 
     /**
      * Unmap a mapped memory range
      *
-     * @note Does not return a result as vkUnmapMemory can't fail
+     * @note The underlying block stays mapped, only this buffer's pointer is dropped
      */
-    void Buffer::unmap() noexcept {
-        if(mapped) {
-            vkUnmapMemory(lveDevice.device(), memory);
-            mapped = nullptr;
-        }
-    }
+    void Buffer::unmap() noexcept { mapped = nullptr; }
 
     DISABLE_WARNINGS_PUSH(26481)
     /**
@@ -99,12 +98,7 @@ namespace lve {
      * @return VkResult of the flush call
      */
     VkResult Buffer::flush(VkDeviceSize size, VkDeviceSize offset) noexcept {
-        VkMappedMemoryRange mappedRange = {};
-        mappedRange.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-        mappedRange.memory = memory;
-        mappedRange.offset = offset;
-        mappedRange.size = size;
-        return vkFlushMappedMemoryRanges(lveDevice.device(), 1, &mappedRange);
+        return lveDevice.allocator().flush(allocation, offset, size);
     }
 
     /**
@@ -119,12 +113,7 @@ namespace lve {
      * @return VkResult of the invalidate call
      */
     VkResult Buffer::invalidate(VkDeviceSize size, VkDeviceSize offset) noexcept {
-        VkMappedMemoryRange mappedRange = {};
-        mappedRange.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-        mappedRange.memory = memory;
-        mappedRange.offset = offset;
-        mappedRange.size = size;
-        return vkInvalidateMappedMemoryRanges(lveDevice.device(), 1, &mappedRange);
+        return lveDevice.allocator().invalidate(allocation, offset, size);
     }
 
     /**
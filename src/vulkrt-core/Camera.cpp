@@ -49,6 +49,19 @@ namespace lve {
         viewMatrix[3][2] = -glm::dot(w, position);
     }
 
+    std::array<glm::vec4, 6> Camera::getFrustumPlanes() const noexcept {
+        // Gribb-Hartmann extraction on the rows of the clip matrix, clip space depth is [0, w] in Vulkan
+        const glm::mat4 clip = projectionMatrix * viewMatrix;
+        const glm::vec4 row0{clip[0][0], clip[1][0], clip[2][0], clip[3][0]};
+        const glm::vec4 row1{clip[0][1], clip[1][1], clip[2][1], clip[3][1]};
+        const glm::vec4 row2{clip[0][2], clip[1][2], clip[2][2], clip[3][2]};
+        const glm::vec4 row3{clip[0][3], clip[1][3], clip[2][3], clip[3][3]};
+
+        std::array<glm::vec4, 6> planes{row3 + row0, row3 - row0, row3 + row1, row3 - row1, row2, row3 - row2};
+        for(auto &plane : planes) { plane /= glm::length(glm::vec3{plane}); }
+        return planes;
+    }
+
     void Camera::setViewTarget(glm::vec3 position, glm::vec3 target, glm::vec3 up) { setViewDirection(position, target - position, up); }
 
     void Camera::setViewYXZ(glm::vec3 position, glm::vec3 rotation) {
@@ -0,0 +1,53 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/ComputePipeline.hpp"
+#include "vulkrt/Pipeline.hpp"
+#include "vulkrt/timer/Timer.hpp"
+
+namespace lve {
+    DISABLE_WARNINGS_PUSH(26432 26447)
+    ComputePipeline::ComputePipeline(Device &device, const std::string &compFilepath, VkPipelineLayout pipelineLayout)
+      : lveDevice{device} {
+#ifdef INDEPTH
+        const vnd::AutoTimer timer{"createComputePipeline", vnd::Timer::Big};
+#endif
+        assert(pipelineLayout != VK_NULL_HANDLE && "Cannot create compute pipeline: no pipelineLayout provided");
+
+        const auto compCode = Pipeline::readFile(compFilepath);
+        const VkShaderModuleCreateInfo moduleInfo{
+            .sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+            .codeSize = compCode.size(),
+            .pCode = C_CPCU32T(compCode.data()),
+        };
+        VK_CHECK(vkCreateShaderModule(lveDevice.device(), &moduleInfo, nullptr, &compShaderModule), "failed to create shader module");
+
+        const VkComputePipelineCreateInfo pipelineInfo{
+            .sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+            .stage = VkPipelineShaderStageCreateInfo{.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+                                                     .stage = VK_SHADER_STAGE_COMPUTE_BIT,
+                                                     .module = compShaderModule,
+                                                     .pName = "main"},
+            .layout = pipelineLayout,
+            .basePipelineHandle = VK_NULL_HANDLE,
+            .basePipelineIndex = -1,
+        };
+        const vnd::Timer creationTimer{"vkCreateComputePipelines"};
+        VK_CHECK(vkCreateComputePipelines(lveDevice.device(), lveDevice.pipelineCache(), 1, &pipelineInfo, nullptr, &computePipeline),
+                 "failed to create compute pipeline");
+        lveDevice.addPipelineCreationTime(creationTimer.make_time());
+    }
+
+    ComputePipeline::~ComputePipeline() {
+        vkDestroyShaderModule(lveDevice.device(), compShaderModule, nullptr);
+        vkDestroyPipeline(lveDevice.device(), computePipeline, nullptr);
+    }
+    DISABLE_WARNINGS_POP()
+
+    void ComputePipeline::bind(VkCommandBuffer commandBuffer) const noexcept {
+        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, computePipeline);
+    }
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
@@ -1,5 +1,7 @@
 // NOLINTBEGIN(*-include-cleaner)
 #include "vulkrt/Device.hpp"
+#include "vulkrt/Model.hpp"
+#include "vulkrt/StagingRing.hpp"
 #include "vulkrt/VlukanLogInfoCallback.hpp"
 #include "vulkrt/timer/Timer.hpp"
 namespace lve {
@@ -95,22 +97,34 @@ namespace lve {
 
     // class member functions
     DISABLE_WARNINGS_PUSH(26432 26447)
-    Device::Device(Window &window) noexcept : window{window} {
+    Device::Device(Window &window) noexcept : Device{&window} {}
+
+    Device::Device(Window *window) : window{window} {
+        if(!isHeadless()) { deviceExtensions.emplace_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME); }
         createInstance();
         setupDebugMessenger();
         createSurface();
         pickPhysicalDevice();
         createLogicalDevice();
+        createAllocator();
+        createPipelineCache();
         createCommandPool();
+        createStagingRing();
+        createMeshPool();
     }
 
     Device::~Device() {
+        meshPool_.reset();
+        stagingRing_.reset();
+        pipelineCache_.reset();
         vkDestroyCommandPool(device_, commandPool, nullptr);
+        allocator_->logStats();
+        allocator_.reset();
         vkDestroyDevice(device_, nullptr);
 
         if(enableValidationLayers) { DestroyDebugUtilsMessengerEXT(instance, debugMessenger, nullptr); }
 
-        vkDestroySurfaceKHR(instance, surface_, nullptr);
+        if(surface_ != VK_NULL_HANDLE) { vkDestroySurfaceKHR(instance, surface_, nullptr); }
         vkDestroyInstance(instance, nullptr);
     }
     DISABLE_WARNINGS_POP()
@@ -162,9 +176,9 @@ namespace lve {
         std::vector<VkPhysicalDevice> devices(deviceCount);
         vkEnumeratePhysicalDevices(instance, &deviceCount, devices.data());
 
-        physicalDevice = *std::ranges::find_if(devices, [this](const VkPhysicalDevice &device) { return isDeviceSuitable(device); });
-
-        if(physicalDevice == VK_NULL_HANDLE) [[unlikely]] { throw std::runtime_error("failed to find a suitable GPU!"); }
+        const auto suitable = std::ranges::find_if(devices, [this](const VkPhysicalDevice &device) { return isDeviceSuitable(device); });
+        if(suitable == devices.end()) [[unlikely]] { throw std::runtime_error("failed to find a suitable GPU!"); }
+        physicalDevice = *suitable;
         vkGetPhysicalDeviceProperties(physicalDevice, &properties);
         LINFO("Dev count: {}", deviceCount);
         LINFO("API Ver: {}", properties.apiVersion);
@@ -178,7 +192,8 @@ namespace lve {
         const QueueFamilyIndices indices = findQueueFamilies(physicalDevice);
 
         std::vector<VkDeviceQueueCreateInfo> queueCreateInfos;
-        const std::set<uint32_t> uniqueQueueFamilies = {indices.graphicsFamily, indices.presentFamily};
+        std::set<uint32_t> uniqueQueueFamilies = {indices.graphicsFamily, indices.presentFamily};
+        if(indices.transferFamilyHasValue) { uniqueQueueFamilies.insert(indices.transferFamily); }
 
         constexpr float queuePriority = 1.0f;
         for(const uint32_t queueFamily : uniqueQueueFamilies) {
@@ -188,8 +203,16 @@ namespace lve {
                                                                   .pQueuePriorities = &queuePriority});
         }
 
+        VkPhysicalDeviceFeatures supportedFeatures{};
+        vkGetPhysicalDeviceFeatures(physicalDevice, &supportedFeatures);
         VkPhysicalDeviceFeatures deviceFeatures = {};
         deviceFeatures.samplerAnisotropy = VK_TRUE;
+        // indirect drawing falls back to one call per command (and per-draw instance offsets) without these
+        deviceFeatures.multiDrawIndirect = supportedFeatures.multiDrawIndirect;
+        deviceFeatures.drawIndirectFirstInstance = supportedFeatures.drawIndirectFirstInstance;
+        // optional instrumentation, see PipelineStatistics
+        deviceFeatures.pipelineStatisticsQuery = supportedFeatures.pipelineStatisticsQuery;
+        enabledFeatures = deviceFeatures;
 
         VkDeviceCreateInfo createInfo = {};
         createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
@@ -223,8 +246,24 @@ namespace lve {
 
         vkGetDeviceQueue(device_, indices.graphicsFamily, 0, &graphicsQueue_);
         vkGetDeviceQueue(device_, indices.presentFamily, 0, &presentQueue_);
+        if(indices.hasDedicatedTransfer()) {
+            vkGetDeviceQueue(device_, indices.transferFamily, 0, &transferQueue_);
+            LINFO("using dedicated transfer queue family {}", indices.transferFamily);
+        } else {
+            transferQueue_ = graphicsQueue_;
+        }
+    }
+
+    void Device::createAllocator() { allocator_ = MAKE_UNIQUE(MemoryAllocator, physicalDevice, device_); }
+
+    void Device::createPipelineCache() {
+        pipelineCache_ = MAKE_UNIQUE(PipelineCache, device_, properties, curentP / PipelineCache::FILE_NAME);
     }
 
+    void Device::createStagingRing() { stagingRing_ = MAKE_UNIQUE(StagingRing, *this); }
+
+    void Device::createMeshPool() { meshPool_ = MAKE_UNIQUE(MeshPool, *this, sizeof(Model::Vertex)); }
+
     void Device::createCommandPool() {
         const QueueFamilyIndices queueFamilyIndices = findPhysicalQueueFamilies();
 
@@ -238,15 +277,21 @@ namespace lve {
         VK_CHECK(vkCreateCommandPool(device_, &poolInfo, nullptr, &commandPool), "failed to create command pool!");
     }
 
-    void Device::createSurface() { window.createWindowSurface(instance, &surface_); }
+    void Device::createSurface() {
+        if(isHeadless()) {
+            LINFO("headless device, no surface");
+            return;
+        }
+        window->createWindowSurface(instance, &surface_);
+    }
 
     bool Device::isDeviceSuitable(VkPhysicalDevice device) {
         const QueueFamilyIndices indices = findQueueFamilies(device);
 
         const bool extensionsSupported = checkDeviceExtensionSupport(device);
 
-        bool swapChainAdequate = false;
-        if(extensionsSupported) {
+        bool swapChainAdequate = isHeadless();
+        if(extensionsSupported && !isHeadless()) {
             const SwapChainSupportDetails swapChainSupport = querySwapChainSupport(device);
             SwapChainSupportDetails::printDetails(swapChainSupport);
             swapChainAdequate = !swapChainSupport.formats.empty() && !swapChainSupport.presentModes.empty();
@@ -294,10 +339,12 @@ namespace lve {
     }
 
     std::vector<const char *> Device::getRequiredExtensions() const {
-        uint32_t glfwExtensionCount = 0;
-        const auto glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
-
-        std::vector<const char *> extensions(glfwExtensions, glfwExtensionCount + glfwExtensions);
+        std::vector<const char *> extensions;
+        if(!isHeadless()) {
+            uint32_t glfwExtensionCount = 0;
+            const auto glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
+            extensions.assign(glfwExtensions, glfwExtensions + glfwExtensionCount);
+        }
 
         if(enableValidationLayers) { extensions.emplace_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME); }
 
@@ -356,7 +403,11 @@ namespace lve {
                 indices.graphicsFamilyHasValue = true;
             }
             VkBool32 presentSupport = false;
-            vkGetPhysicalDeviceSurfaceSupportKHR(device, C_UI32T(i), surface_, &presentSupport);
+            if(isHeadless()) {
+                presentSupport = C_BOOL(queueFamily.queueFlags & VK_QUEUE_GRAPHICS_BIT) ? VK_TRUE : VK_FALSE;  // NOLINT(*-signed-bitwise)
+            } else {
+                vkGetPhysicalDeviceSurfaceSupportKHR(device, C_UI32T(i), surface_, &presentSupport);
+            }
             if(queueFamily.queueCount > 0 && C_BOOL(presentSupport)) {
                 indices.presentFamily = C_UI32T(i);
                 indices.presentFamilyHasValue = true;
@@ -364,6 +415,26 @@ namespace lve {
             if(indices.isComplete()) { break; }
         }
 
+        // prefer a pure DMA family, then any non-graphics one (async compute also copies); graphics is the fallback
+        // NOLINTBEGIN(*-signed-bitwise)
+        constexpr std::array<VkQueueFlags, 2> excluded{VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, VK_QUEUE_GRAPHICS_BIT};
+        for(const VkQueueFlags mask : excluded) {
+            for(const auto &[i, queueFamily] : queueFamilies | std::views::enumerate) {
+                const bool canCopy = C_BOOL(queueFamily.queueFlags & (VK_QUEUE_TRANSFER_BIT | VK_QUEUE_COMPUTE_BIT));
+                if(queueFamily.queueCount > 0 && canCopy && !C_BOOL(queueFamily.queueFlags & mask)) {
+                    indices.transferFamily = C_UI32T(i);
+                    indices.transferFamilyHasValue = true;
+                    break;
+                }
+            }
+            if(indices.transferFamilyHasValue) { break; }
+        }
+        // NOLINTEND(*-signed-bitwise)
+        if(!indices.transferFamilyHasValue && indices.graphicsFamilyHasValue) {
+            indices.transferFamily = indices.graphicsFamily;
+            indices.transferFamilyHasValue = true;
+        }
+
         return indices;
     }
 
@@ -429,22 +500,38 @@ namespace lve {
     }
 
     void Device::createBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags mproperties, VkBuffer &buffer,
-                              VkDeviceMemory &bufferMemory) {
-        const VkBufferCreateInfo bufferInfo = {
+                              Allocation &allocation, VkSharingMode sharingMode) {
+        VkBufferCreateInfo bufferInfo = {
             .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO, .size = size, .usage = usage, .sharingMode = VK_SHARING_MODE_EXCLUSIVE};
 
+        const QueueFamilyIndices indices = findPhysicalQueueFamilies();
+        const std::array<uint32_t, 2> queueFamilyIndices = {indices.graphicsFamily, indices.transferFamily};
+        if(sharingMode == VK_SHARING_MODE_CONCURRENT && indices.hasDedicatedTransfer()) {
+            bufferInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+            bufferInfo.queueFamilyIndexCount = 2;
+            bufferInfo.pQueueFamilyIndices = queueFamilyIndices.data();
+        }
+
         VK_CHECK(vkCreateBuffer(device_, &bufferInfo, nullptr, &buffer), "failed to create buffer!");
 
         VkMemoryRequirements memRequirements;
         vkGetBufferMemoryRequirements(device_, buffer, &memRequirements);
 
-        const VkMemoryAllocateInfo allocInfo = {.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
-                                                .allocationSize = memRequirements.size,
-                                                .memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, mproperties)};
-
-        VK_CHECK(vkAllocateMemory(device_, &allocInfo, nullptr, &bufferMemory), "failed to allocate vertex buffer memory!");
+        allocation = {};
+        try {
+            allocation = allocator_->allocate(memRequirements, mproperties, false);
+            VK_CHECK(vkBindBufferMemory(device_, buffer, allocation.memory, allocation.offset), "failed to bind buffer memory!");
+        } catch(...) {
+            // free() skips the empty allocation left behind when allocate() itself threw
+            destroyBuffer(buffer, allocation);
+            throw;
+        }
+    }
 
-        vkBindBufferMemory(device_, buffer, bufferMemory, 0);
+    void Device::destroyBuffer(VkBuffer &buffer, Allocation &allocation) noexcept {
+        vkDestroyBuffer(device_, buffer, nullptr);
+        buffer = VK_NULL_HANDLE;
+        allocator_->free(allocation);
     }
 
     VkCommandBuffer Device::beginSingleTimeCommands() noexcept {
@@ -506,19 +593,26 @@ namespace lve {
     }
 
     void Device::createImageWithInfo(const VkImageCreateInfo &imageInfo, VkMemoryPropertyFlags mproperties, VkImage &image,
-                                     VkDeviceMemory &imageMemory) {
+                                     Allocation &allocation) {
         VK_CHECK(vkCreateImage(device_, &imageInfo, nullptr, &image), "failed to create image!");
 
         VkMemoryRequirements memRequirements;
         vkGetImageMemoryRequirements(device_, image, &memRequirements);
 
-        const VkMemoryAllocateInfo allocInfo = {.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
-                                                .allocationSize = memRequirements.size,
-                                                .memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, mproperties)};
-
-        VK_CHECK(vkAllocateMemory(device_, &allocInfo, nullptr, &imageMemory), "failed to allocate image memory!");
+        allocation = {};
+        try {
+            allocation = allocator_->allocate(memRequirements, mproperties, imageInfo.tiling == VK_IMAGE_TILING_OPTIMAL);
+            VK_CHECK(vkBindImageMemory(device_, image, allocation.memory, allocation.offset), "failed to bind image memory!");
+        } catch(...) {
+            destroyImage(image, allocation);
+            throw;
+        }
+    }
 
-        VK_CHECK(vkBindImageMemory(device_, image, imageMemory, 0), "failed to bind image memory!");
+    void Device::destroyImage(VkImage &image, Allocation &allocation) noexcept {
+        vkDestroyImage(device_, image, nullptr);
+        image = VK_NULL_HANDLE;
+        allocator_->free(allocation);
     }
     DISABLE_WARNINGS_POP()
 
@@ -17,12 +17,20 @@ std::string FPSCounter::transformTime(const long double inputTimeMilli) const no
 
 void FPSCounter::frame() {
     updateFPS();
-    LINFO("{:.3LF} fps/{}", fps, ms_per_frame);
+    if(m_detail.empty()) {
+        LINFO("{:.3LF} fps/{}", fps, ms_per_frame);
+    } else {
+        LINFO("{:.3LF} fps/{} - {}", fps, ms_per_frame, m_detail);
+    }
 }
 
 void FPSCounter::frameInTitle() {
     updateFPS();
-    glfwSetWindowTitle(m_window, FORMATST("{} - {:.3LF} fps/{}", m_title, fps, ms_per_frameComposition).c_str());
+    if(m_detail.empty()) {
+        glfwSetWindowTitle(m_window, FORMATST("{} - {:.3LF} fps/{}", m_title, fps, ms_per_frameComposition).c_str());
+    } else {
+        glfwSetWindowTitle(m_window, FORMATST("{} - {:.3LF} fps/{} - {}", m_title, fps, ms_per_frameComposition, m_detail).c_str());
+    }
 }
 
 void FPSCounter::updateFPS() noexcept {
@@ -0,0 +1,50 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/FramePacer.hpp"
+
+#include <thread>
+
+namespace lve {
+    // the OS timer may wake a sleeping thread late by about this much, the remainder is spun away
+    static inline constexpr auto SPIN_MARGIN = ch::microseconds{1500};
+    static inline constexpr double LATENCY_SMOOTHING = 1.0 / 64.0;
+
+    FramePacer::FramePacer(double targetFps) noexcept { setTargetFps(targetFps); }
+
+    void FramePacer::setTargetFps(double targetFps) noexcept {
+        targetFrameTime = targetFps > 0.0 ? ch::duration_cast<clock::duration>(ch::duration<double>{1.0 / targetFps}) : clock::duration{};
+        deadline = clock::now();
+    }
+
+    void FramePacer::wait() noexcept {
+        if(!isCapped()) {
+            frameStats.lastSleepMs = 0.0;
+            return;
+        }
+        const auto start = clock::now();
+        deadline += targetFrameTime;
+        if(deadline < start) [[unlikely]] {
+            // missed the deadline by more than a frame, do not try to catch up
+            deadline = start;
+        } else {
+            if(deadline - start > SPIN_MARGIN) { std::this_thread::sleep_until(deadline - SPIN_MARGIN); }
+            while(clock::now() < deadline) { std::this_thread::yield(); }
+        }
+        frameStats.lastSleepMs = ch::duration<double, std::milli>{clock::now() - start}.count();
+    }
+
+    void FramePacer::markInput() noexcept { inputTime = clock::now(); }
+
+    void FramePacer::markPresent() noexcept {
+        const double latency = ch::duration<double, std::milli>{clock::now() - inputTime}.count();
+        frameStats.lastLatencyMs = latency;
+        frameStats.averageLatencyMs =
+            frameStats.frames == 0 ? latency : frameStats.averageLatencyMs + (latency - frameStats.averageLatencyMs) * LATENCY_SMOOTHING;
+        frameStats.maxLatencyMs = std::max(frameStats.maxLatencyMs, latency);
+        ++frameStats.frames;
+    }
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
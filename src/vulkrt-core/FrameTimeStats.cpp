@@ -0,0 +1,34 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/FrameTimeStats.hpp"
+
+namespace lve {
+    DISABLE_WARNINGS_PUSH(26446)
+    FrameTimeStats::Summary FrameTimeStats::summarize() const {
+        if(samples.empty()) [[unlikely]] { return Summary{}; }
+        std::vector<double> sorted{samples};
+        std::ranges::sort(sorted);
+        const auto percentile = [&sorted](double p) {
+            const auto rank = C_ST(std::ceil(p * C_D(sorted.size())));
+            return sorted[std::clamp(rank, std::size_t{1}, sorted.size()) - 1];
+        };
+        return Summary{.frames = sorted.size(),
+                       .minMs = sorted.front(),
+                       .meanMs = std::accumulate(sorted.begin(), sorted.end(), 0.0) / C_D(sorted.size()),
+                       .p50Ms = percentile(0.50),
+                       .p95Ms = percentile(0.95),
+                       .p99Ms = percentile(0.99),
+                       .maxMs = sorted.back()};
+    }
+    DISABLE_WARNINGS_POP()
+
+    void FrameTimeStats::log(std::string_view label) const {
+        const Summary summary = summarize();
+        LINFO("{}: {} frames, {:.1f} fps, ms min {:.3f} mean {:.3f} p50 {:.3f} p95 {:.3f} p99 {:.3f} max {:.3f}", label, summary.frames,
+              summary.fps(), summary.minMs, summary.meanMs, summary.p50Ms, summary.p95Ms, summary.p99Ms, summary.maxMs);
+    }
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
@@ -0,0 +1,147 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/FrustumCuller.hpp"
+
+#if defined(__AVX2__) || defined(__AVX__)
+#include <immintrin.h>
+#define VULKRT_CULL_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VULKRT_CULL_SSE
+#endif
+
+namespace lve {
+    DISABLE_WARNINGS_PUSH(26446 26481 26482)
+    void FrustumCuller::SphereBatch::clear() noexcept {
+        centerX.clear();
+        centerY.clear();
+        centerZ.clear();
+        radius.clear();
+    }
+
+    void FrustumCuller::SphereBatch::reserve(std::size_t count) {
+        centerX.reserve(count);
+        centerY.reserve(count);
+        centerZ.reserve(count);
+        radius.reserve(count);
+    }
+
+    void FrustumCuller::SphereBatch::push(const glm::vec4 &sphere) {
+        centerX.emplace_back(sphere.x);
+        centerY.emplace_back(sphere.y);
+        centerZ.emplace_back(sphere.z);
+        radius.emplace_back(sphere.w);
+    }
+
+    glm::vec4 FrustumCuller::transformSphere(const glm::mat4 &modelMatrix, const glm::vec4 &sphere) noexcept {
+        const glm::vec3 center{modelMatrix * glm::vec4{glm::vec3{sphere}, 1.0F}};
+        const float scale = std::max({glm::length(glm::vec3{modelMatrix[0]}), glm::length(glm::vec3{modelMatrix[1]}),
+                                      glm::length(glm::vec3{modelMatrix[2]})});
+        return glm::vec4{center, sphere.w * scale};
+    }
+
+    bool FrustumCuller::isVisible(const Planes &planes, const glm::vec4 &worldSphere) noexcept {
+        // same evaluation order as the vector paths
+        return std::ranges::all_of(planes, [&](const glm::vec4 &plane) {
+            return (plane.x * worldSphere.x + plane.y * worldSphere.y) + (plane.z * worldSphere.z + plane.w) >= -worldSphere.w;
+        });
+    }
+
+    namespace {
+        std::size_t cullTail(const FrustumCuller::Planes &planes, const FrustumCuller::SphereBatch &batch, std::size_t begin,
+                             uint32_t *visible) noexcept {
+            std::size_t count = 0;
+            for(std::size_t i = begin; i < batch.size(); ++i) {
+                const glm::vec4 sphere{batch.centerX[i], batch.centerY[i], batch.centerZ[i], batch.radius[i]};
+                if(FrustumCuller::isVisible(planes, sphere)) { visible[count++] = C_UI32T(i); }
+            }
+            return count;
+        }
+
+        // appends begin + the position of every set bit of mask
+        inline std::size_t emitMask(unsigned mask, std::size_t begin, uint32_t *visible) noexcept {
+            std::size_t count = 0;
+            while(mask != 0) {
+                visible[count++] = C_UI32T(begin + C_ST(std::countr_zero(mask)));
+                mask &= mask - 1;
+            }
+            return count;
+        }
+    }  // namespace
+
+    std::size_t FrustumCuller::cullScalar(const Planes &planes, const SphereBatch &batch, uint32_t *visible) noexcept {
+        return cullTail(planes, batch, 0, visible);
+    }
+
+    std::size_t FrustumCuller::cull(const Planes &planes, const SphereBatch &batch, uint32_t *visible) noexcept {
+        const std::size_t size = batch.size();
+        const float *xs = batch.centerX.data();
+        const float *ys = batch.centerY.data();
+        const float *zs = batch.centerZ.data();
+        const float *rs = batch.radius.data();
+        std::size_t count = 0;
+        std::size_t i = 0;
+#if defined(VULKRT_CULL_AVX)
+        static constexpr std::size_t LANES = 8;
+        __m256 p[24];  // NOLINT(*-avoid-c-arrays) plane components broadcast once: nx, ny, nz, d per plane
+        for(std::size_t k = 0; k < planes.size(); ++k) {
+            for(int c = 0; c < 4; ++c) { p[k * 4 + C_ST(c)] = _mm256_set1_ps(planes[k][c]); }
+        }
+        const __m256 zero = _mm256_setzero_ps();
+        for(; i + LANES <= size; i += LANES) {
+            const __m256 x = _mm256_loadu_ps(xs + i);
+            const __m256 y = _mm256_loadu_ps(ys + i);
+            const __m256 z = _mm256_loadu_ps(zs + i);
+            const __m256 negRadius = _mm256_sub_ps(zero, _mm256_loadu_ps(rs + i));
+            __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+            for(std::size_t k = 0; k < 24; k += 4) {
+                const __m256 distance = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(p[k], x), _mm256_mul_ps(p[k + 1], y)),
+                                                      _mm256_add_ps(_mm256_mul_ps(p[k + 2], z), p[k + 3]));
+                inside = _mm256_and_ps(inside, _mm256_cmp_ps(distance, negRadius, _CMP_GE_OQ));
+            }
+            count += emitMask(C_UI32T(_mm256_movemask_ps(inside)), i, visible + count);
+        }
+#elif defined(VULKRT_CULL_SSE)
+        static constexpr std::size_t LANES = 4;
+        __m128 p[24];  // NOLINT(*-avoid-c-arrays)
+        for(std::size_t k = 0; k < planes.size(); ++k) {
+            for(int c = 0; c < 4; ++c) { p[k * 4 + C_ST(c)] = _mm_set1_ps(planes[k][c]); }
+        }
+        const __m128 zero = _mm_setzero_ps();
+        for(; i + LANES <= size; i += LANES) {
+            const __m128 x = _mm_loadu_ps(xs + i);
+            const __m128 y = _mm_loadu_ps(ys + i);
+            const __m128 z = _mm_loadu_ps(zs + i);
+            const __m128 negRadius = _mm_sub_ps(zero, _mm_loadu_ps(rs + i));
+            __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+            for(std::size_t k = 0; k < 24; k += 4) {
+                const __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(p[k], x), _mm_mul_ps(p[k + 1], y)),
+                                                   _mm_add_ps(_mm_mul_ps(p[k + 2], z), p[k + 3]));
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, negRadius));
+            }
+            count += emitMask(C_UI32T(_mm_movemask_ps(inside)), i, visible + count);
+        }
+#else
+        (void)xs;
+        (void)ys;
+        (void)zs;
+        (void)rs;
+#endif
+        return count + cullTail(planes, batch, i, visible + count);
+    }
+
+    std::string_view FrustumCuller::isa() noexcept {
+#if defined(VULKRT_CULL_AVX)
+        return "AVX";
+#elif defined(VULKRT_CULL_SSE)
+        return "SSE2";
+#else
+        return "scalar";
+#endif
+    }
+    DISABLE_WARNINGS_POP()
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
@@ -7,7 +7,7 @@
 namespace lve {
     // NOLINTBEGIN(*-pro-type-union-access)
 
-    glm::mat4 TransformComponent::mat4() const {
+    glm::mat4 TransformComponent::computeMat4(const glm::vec3 &translation, const glm::vec3 &rotation, const glm::vec3 &scale) noexcept {
         // auto transform = glm::translate(glm::mat4{1.0F}, translation);
         // transform *= glm::toMat4(glm::quat(rotation));
         // transform = glm::scale(transform, scale);
@@ -42,7 +42,7 @@ namespace lve {
                          {sz_c2_s1, sz_neg_s2, sz_c1_c2, 0.0f},
                          {translation.x, translation.y, translation.z, 1.0f}};
     }
-    glm::mat4 TransformComponent::normalMatrix() const {
+    glm::mat4 TransformComponent::computeNormalMatrix(const glm::vec3 &rotation, const glm::vec3 &scale) noexcept {
         const float c3 = glm::cos(rotation.z);
         const float s3 = glm::sin(rotation.z);
         const float c2 = glm::cos(rotation.x);
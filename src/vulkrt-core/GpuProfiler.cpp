@@ -0,0 +1,131 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/GpuProfiler.hpp"
+
+namespace lve {
+    static inline constexpr double GPU_TIME_SMOOTHING = 1.0 / 64.0;
+
+    GpuProfiler::GpuProfiler(Device &device, uint32_t framesInFlight) : lveDevice{device}, slots(framesInFlight) {
+        frameScope = scopeId("frame");
+        const VkPhysicalDeviceLimits &limits = lveDevice.properties.limits;
+        uint32_t familyCount = 0;
+        vkGetPhysicalDeviceQueueFamilyProperties(lveDevice.getPhysicalDevice(), &familyCount, nullptr);
+        std::vector<VkQueueFamilyProperties> families(familyCount);
+        vkGetPhysicalDeviceQueueFamilyProperties(lveDevice.getPhysicalDevice(), &familyCount, families.data());
+        const uint32_t validBits = families.at(lveDevice.findPhysicalQueueFamilies().graphicsFamily).timestampValidBits;
+        if(limits.timestampComputeAndGraphics == VK_FALSE || limits.timestampPeriod <= 0.0F || validBits == 0) [[unlikely]] {
+            LWARN("gpu profiler: the graphics queue has no timestamps, GPU times are not measured");
+            return;
+        }
+        timestampMask = validBits >= 64 ? ~uint64_t{0} : (uint64_t{1} << validBits) - 1;
+        timestampPeriodMs = C_D(limits.timestampPeriod) * 1e-6;
+
+        const VkQueryPoolCreateInfo poolInfo{
+            .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+            .queryType = VK_QUERY_TYPE_TIMESTAMP,
+            .queryCount = framesInFlight * MAX_SCOPES * 2,
+        };
+        VK_CHECK(vkCreateQueryPool(lveDevice.device(), &poolInfo, nullptr, &queryPool), "failed to create timestamp query pool!");
+        for(Slot &slot : slots) { slot.scopes.reserve(MAX_SCOPES); }
+        results.resize(C_ST(MAX_SCOPES) * 4);
+    }
+
+    GpuProfiler::~GpuProfiler() {
+        if(queryPool != VK_NULL_HANDLE) { vkDestroyQueryPool(lveDevice.device(), queryPool, nullptr); }
+    }
+
+    uint32_t GpuProfiler::scopeId(std::string_view name) {
+        const auto it = std::ranges::find(stats, name, &ScopeStats::name);
+        if(it != stats.end()) { return C_UI32T(std::distance(stats.begin(), it)); }
+        stats.emplace_back(ScopeStats{.name = std::string{name}});
+        scopeMs.resize(stats.size());
+        return C_UI32T(stats.size() - 1);
+    }
+
+    DISABLE_WARNINGS_PUSH(26446)
+    void GpuProfiler::beginFrame(VkCommandBuffer commandBuffer, uint32_t frameIndex, uint64_t frameNumber) {
+        if(!isEnabled()) { return; }
+        readBack(frameIndex, false);
+        currentSlot = frameIndex;
+        Slot &slot = slots[frameIndex];
+        slot.scopes.clear();
+        slot.frameNumber = frameNumber;
+        slot.pending = true;
+        vkCmdResetQueryPool(commandBuffer, queryPool, frameIndex * MAX_SCOPES * 2, MAX_SCOPES * 2);
+        frameQuery = beginScope(commandBuffer, frameScope);
+    }
+
+    void GpuProfiler::endFrame(VkCommandBuffer commandBuffer) noexcept {
+        endScope(commandBuffer, std::exchange(frameQuery, INVALID_SCOPE));
+    }
+
+    uint32_t GpuProfiler::beginScope(VkCommandBuffer commandBuffer, uint32_t id, VkPipelineStageFlagBits stage) noexcept {
+        Slot &slot = slots[currentSlot];
+        if(!isEnabled() || !slot.pending || slot.scopes.size() >= MAX_SCOPES) [[unlikely]] { return INVALID_SCOPE; }
+        const auto query = (currentSlot * MAX_SCOPES + C_UI32T(slot.scopes.size())) * 2;
+        slot.scopes.emplace_back(id);  // capacity reserved for MAX_SCOPES
+        vkCmdWriteTimestamp(commandBuffer, stage, queryPool, query);
+        return query;
+    }
+
+    void GpuProfiler::endScope(VkCommandBuffer commandBuffer, uint32_t query, VkPipelineStageFlagBits stage) noexcept {
+        if(query == INVALID_SCOPE) { return; }
+        vkCmdWriteTimestamp(commandBuffer, stage, queryPool, query + 1);
+    }
+
+    void GpuProfiler::readBack(uint32_t frameIndex, bool wait) {
+        Slot &slot = slots[frameIndex];
+        if(!slot.pending || slot.scopes.empty()) { return; }
+        // value and availability of every query, or only the values when waiting
+        const auto queryCount = C_UI32T(slot.scopes.size() * 2);
+        const VkDeviceSize stride = 2 * sizeof(uint64_t);
+        const VkQueryResultFlags flags =
+            VK_QUERY_RESULT_64_BIT | (wait ? VK_QUERY_RESULT_WAIT_BIT : VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);  // NOLINT(*-signed-bitwise)
+        const VkResult result = vkGetQueryPoolResults(lveDevice.device(), queryPool, frameIndex * MAX_SCOPES * 2, queryCount,
+                                                      queryCount * stride, results.data(), stride, flags);
+        if(result != VK_SUCCESS) [[unlikely]] { return; }  // VK_NOT_READY, the frame is dropped
+        slot.pending = false;
+
+        std::ranges::fill(scopeMs, -1.0);
+        for(std::size_t i = 0; i < slot.scopes.size(); ++i) {
+            const uint64_t *begin = &results[i * 4];
+            const uint64_t *end = &results[i * 4 + 2];
+            if(!wait && (begin[1] == 0 || end[1] == 0)) [[unlikely]] { continue; }
+            const double ms = C_D((end[0] - begin[0]) & timestampMask) * timestampPeriodMs;
+            double &total = scopeMs[slot.scopes[i]];
+            total = total < 0.0 ? ms : total + ms;
+        }
+        for(std::size_t id = 0; id < stats.size(); ++id) {
+            const double ms = scopeMs[id];
+            if(ms < 0.0) { continue; }
+            ScopeStats &scope = stats[id];
+            scope.lastMs = ms;
+            scope.averageMs = scope.frames == 0 ? ms : scope.averageMs + (ms - scope.averageMs) * GPU_TIME_SMOOTHING;
+            scope.maxMs = std::max(scope.maxMs, ms);
+            ++scope.frames;
+        }
+        if(scopeMs[frameScope] >= 0.0) { frameTimes.emplace_back(FrameTime{slot.frameNumber, scopeMs[frameScope]}); }
+    }
+    DISABLE_WARNINGS_POP()
+
+    std::vector<GpuProfiler::FrameTime> GpuProfiler::takeFrameTimes(bool afterIdle) {
+        if(afterIdle && isEnabled()) {
+            // oldest first: the slot after the current one was submitted the longest ago
+            for(std::size_t i = 1; i <= slots.size(); ++i) { readBack(C_UI32T((currentSlot + i) % slots.size()), true); }
+        }
+        return std::exchange(frameTimes, {});
+    }
+
+    void GpuProfiler::log() const {
+        if(!isEnabled()) { return; }
+        for(const ScopeStats &scope : stats) {
+            if(scope.frames == 0) { continue; }
+            LINFO("gpu {}: {:.3f} ms last, {:.3f} ms average, {:.3f} ms max over {} frames", scope.name, scope.lastMs, scope.averageMs,
+                  scope.maxMs, scope.frames);
+        }
+    }
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
@@ -0,0 +1,373 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/IndirectRenderSystem.hpp"
+#include "vulkrt/MeshPool.hpp"
+#include "vulkrt/SwapChain.hpp"
+
+#include <vulkrt/timer/Timer.hpp>
+
+namespace lve {
+    DISABLE_WARNINGS_PUSH(4324)
+    // only declared so the layout matches simple_shader.frag, the indirect path never pushes
+    struct IndirectPushConstantData {
+        glm::mat4 modelMatrix{1.0F};
+        glm::mat4 normalMatrix{1.0F};
+    };
+
+    // std430 layout of cull.comp's ObjectData
+    struct CullObjectData {
+        glm::mat4 modelMatrix{1.0F};
+        glm::mat4 normalMatrix{1.0F};
+        glm::vec4 sphere{};
+        uint32_t command = 0;
+        uint32_t instanceBase = 0;
+        uint32_t pad0 = 0;
+        uint32_t pad1 = 0;
+    };
+
+    struct CullPushConstantData {
+        std::array<glm::vec4, 6> planes{};
+        uint32_t objectCount = 0;
+    };
+    DISABLE_WARNINGS_POP()
+    DISABLE_WARNINGS_PUSH(26432 26446 26447 26482)
+    static inline constexpr uint32_t INSTANCE_BINDING = 1;
+    static inline constexpr uint32_t COMMAND_STRIDE = sizeof(VkDrawIndexedIndirectCommand);
+    static inline constexpr uint32_t CULL_WORKGROUP_SIZE = 64;
+    static inline constexpr uint32_t CULL_BINDING_COUNT = 4;
+    static inline constexpr std::size_t MIN_CAPACITY = 256;
+    static inline constexpr uint32_t SKIPPED = std::numeric_limits<uint32_t>::max();
+
+    IndirectRenderSystem::IndirectRenderSystem(Device &device, VkRenderPass renderPass, VkDescriptorSetLayout globalSetLayout,
+                                               uint32_t framesInFlight, CullMode mode)
+      : lveDevice{device}, cullMode{mode}, frames(framesInFlight) {
+        createPipelineLayout(globalSetLayout);
+        createPipeline(renderPass);
+        createCullResources();
+        const auto &features = lveDevice.features();
+        if(!features.multiDrawIndirect || !features.drawIndirectFirstInstance) [[unlikely]] {
+            LWARN("multiDrawIndirect: {}, drawIndirectFirstInstance: {}, indirect draws are issued one by one",
+                  features.multiDrawIndirect == VK_TRUE, features.drawIndirectFirstInstance == VK_TRUE);
+        }
+    }
+
+    IndirectRenderSystem::~IndirectRenderSystem() {
+        vkDestroyPipelineLayout(lveDevice.device(), pipelineLayout, nullptr);
+        vkDestroyPipelineLayout(lveDevice.device(), cullPipelineLayout, nullptr);
+    }
+
+    void IndirectRenderSystem::createPipelineLayout(VkDescriptorSetLayout globalSetLayout) {
+        const VkPushConstantRange pushConstantRange{
+            .stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+            .offset = 0,
+            .size = sizeof(IndirectPushConstantData),
+        };
+
+        std::array<VkDescriptorSetLayout, 1> descriptorSetLayouts{globalSetLayout};
+
+        const VkPipelineLayoutCreateInfo pipelineLayoutInfo{
+            .sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+            .setLayoutCount = C_UI32T(descriptorSetLayouts.size()),
+            .pSetLayouts = descriptorSetLayouts.data(),
+            .pushConstantRangeCount = 1,
+            .pPushConstantRanges = &pushConstantRange,
+        };
+
+        VK_CHECK(vkCreatePipelineLayout(lveDevice.device(), &pipelineLayoutInfo, nullptr, &pipelineLayout),
+                 "failed to  create pipeline layout!");
+    }
+
+    void IndirectRenderSystem::createPipeline(VkRenderPass renderPass) {
+        assert(pipelineLayout != nullptr && "Cannot create pipeline before pipeline layout");
+
+        PipelineConfigInfo pipelineConfig{};
+        Pipeline::defaultPipelineConfigInfo(pipelineConfig);
+        pipelineConfig.renderPass = renderPass;
+        pipelineConfig.pipelineLayout = pipelineLayout;
+        pipelineConfig.bindingDescriptions.emplace_back(Model::InstanceData::getBindingDescription(INSTANCE_BINDING));
+        std::ranges::copy(Model::InstanceData::getAttributeDescriptions(INSTANCE_BINDING),
+                          std::back_inserter(pipelineConfig.attributeDescriptions));
+        const auto vertPath = Window::calculateRelativePathToSrcShaders(curentP, "instanced_shader.vert.opt.rmp.spv").string();
+        const auto fragPath = Window::calculateRelativePathToSrcShaders(curentP, "simple_shader.frag.opt.rmp.spv").string();
+        lvePipeline = MAKE_UNIQUE(Pipeline, lveDevice, vertPath, fragPath, pipelineConfig);
+    }
+
+    void IndirectRenderSystem::createCullResources() {
+        if(cullMode != CullMode::Gpu) { return; }
+
+        cullSetLayout = DescriptorSetLayout::Builder(lveDevice)
+                            .addBinding(0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
+                            .addBinding(1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
+                            .addBinding(2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
+                            .addBinding(3, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
+                            .build();
+        cullPool = DescriptorPool::Builder(lveDevice)
+                       .setMaxSets(C_UI32T(frames.size()))
+                       .addPoolSize(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, C_UI32T(frames.size()) * CULL_BINDING_COUNT)
+                       .build();
+
+        const VkPushConstantRange pushConstantRange{
+            .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+            .offset = 0,
+            .size = sizeof(CullPushConstantData),
+        };
+        const VkDescriptorSetLayout setLayout = cullSetLayout->getDescriptorSetLayout();
+        const VkPipelineLayoutCreateInfo pipelineLayoutInfo{
+            .sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+            .setLayoutCount = 1,
+            .pSetLayouts = &setLayout,
+            .pushConstantRangeCount = 1,
+            .pPushConstantRanges = &pushConstantRange,
+        };
+        VK_CHECK(vkCreatePipelineLayout(lveDevice.device(), &pipelineLayoutInfo, nullptr, &cullPipelineLayout),
+                 "failed to  create cull pipeline layout!");
+        const auto compPath = Window::calculateRelativePathToSrcShaders(curentP, "cull.comp.opt.rmp.spv").string();
+        cullPipeline = MAKE_UNIQUE(ComputePipeline, lveDevice, compPath, cullPipelineLayout);
+
+        for(auto &frame : frames) {
+            if(!cullPool->allocateDescriptor(setLayout, frame.cullSet)) [[unlikely]] {
+                throw std::runtime_error("failed to allocate cull descriptor set!");
+            }
+            frame.counters = MAKE_UNIQUE(Buffer, lveDevice, sizeof(uint32_t), 1, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                                         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+            VK_CHECK(frame.counters->map(), "failed to map cull counters!");
+        }
+    }
+
+    bool IndirectRenderSystem::reserve(Device &device, std::unique_ptr<Buffer> &buffer, VkDeviceSize stride, std::size_t count,
+                                       VkBufferUsageFlags usage) {
+        // called for the current slot only, whose buffers no frame on the GPU still reads, see Renderer::beginFrame
+        if(buffer != nullptr && buffer->getInstanceCount() >= count) [[likely]] { return false; }
+        std::size_t capacity = buffer == nullptr ? MIN_CAPACITY : buffer->getInstanceCount();
+        while(capacity < count) { capacity *= 2; }
+        buffer = MAKE_UNIQUE(Buffer, device, stride, C_UI32T(capacity), usage, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+        VK_CHECK(buffer->map(), "failed to map indirect render buffer!");
+        return true;
+    }
+
+    void IndirectRenderSystem::buildCommands(const FrameInfo &frameInfo) {
+        const FrustumCuller::Planes planes = frameInfo.camera.getFrustumPlanes();
+        FrameResources &frame = frames[C_ST(frameInfo.frameIndex)];
+
+        // pass 1: count the instances of every model; objects not handed to the GPU are culled right here
+        groupIndex.clear();
+        groups.clear();
+        objectGroups.clear();
+        gpuObjectCount = 0;
+        frame.cpuTested = 0;
+        frame.cpuVisible = 0;
+        const SceneStore &scene = frameInfo.scene;
+        const auto models = scene.models();
+        const auto modelMatrices = scene.modelMatrices();
+        const auto normalMatrices = scene.normalMatrices();
+        for(uint32_t index = 0; index < C_UI32T(models.size()); ++index) {
+            Model *model = models[index].get();
+            if(model == nullptr || !model->isReady()) {
+                objectGroups.emplace_back(SKIPPED);
+                continue;
+            }
+            const bool gpuCulled = cullMode == CullMode::Gpu && model->poolRange() != nullptr;
+            if(cullMode != CullMode::None && !gpuCulled) {
+                ++frame.cpuTested;
+                // same test as cull.comp
+                const glm::vec4 sphere = FrustumCuller::transformSphere(modelMatrices[index], model->boundingSphere());
+                if(!FrustumCuller::isVisible(planes, sphere)) {
+                    objectGroups.emplace_back(SKIPPED);
+                    continue;
+                }
+                ++frame.cpuVisible;
+            }
+            if(gpuCulled) { ++gpuObjectCount; }
+            const auto [it, inserted] = groupIndex.try_emplace(model, C_UI32T(groups.size()));
+            if(inserted) { groups.emplace_back(DrawGroup{model, 0, 0, SKIPPED}); }
+            ++groups[it->second].instanceCount;
+            objectGroups.emplace_back(it->second);
+        }
+
+        uint32_t instanceCount = 0;
+        commandCount = 0;
+        groupBases.clear();
+        for(auto &group : groups) {
+            group.firstInstance = instanceCount;
+            groupBases.emplace_back(instanceCount);
+            instanceCount += group.instanceCount;
+            group.instanceCount = 0;  // reused as write cursor below
+            if(group.model->poolRange() != nullptr) [[likely]] { group.command = commandCount++; }
+        }
+        if(groups.empty()) { return; }
+
+        // NOLINTBEGIN(*-signed-bitwise)
+        const bool gpu = cullMode == CullMode::Gpu;
+        const VkBufferUsageFlags storage = gpu ? VK_BUFFER_USAGE_STORAGE_BUFFER_BIT : 0;
+        frame.descriptorsDirty |= reserve(lveDevice, frame.instances, sizeof(Model::InstanceData), instanceCount,
+                                          VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | storage);
+        frame.descriptorsDirty |= reserve(lveDevice, frame.commands, COMMAND_STRIDE, commandCount,
+                                          VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | storage);
+        bool objectsRecreated = false;
+        if(gpu) {
+            objectsRecreated = reserve(lveDevice, frame.objects, sizeof(CullObjectData), instanceCount, storage);
+            frame.descriptorsDirty |= objectsRecreated;
+        }
+        // NOLINTEND(*-signed-bitwise)
+
+        // the cull input keeps its layout while no object moved between slots or groups, then only the transforms
+        // changed since this slot's last upload are rewritten
+        const bool objectsReusable = gpu && !objectsRecreated && frame.uploadedStamp >= scene.structureStamp() &&
+                                     frame.uploadedCount == gpuObjectCount && frame.uploadedBases == groupBases;
+        uint32_t gpuSlot = 0;
+        uint32_t firstWritten = gpuObjectCount;
+        uint32_t lastWritten = 0;
+
+        // pass 2: CPU drawn objects go straight into their model's instance run, GPU culled ones into the cull input
+        auto *instances = static_cast<Model::InstanceData *>(frame.instances->getMappedMemory());
+        auto *objects = gpu ? static_cast<CullObjectData *>(frame.objects->getMappedMemory()) : nullptr;
+        for(uint32_t index = 0; index < C_UI32T(objectGroups.size()); ++index) {
+            const uint32_t group = objectGroups[index];
+            if(group == SKIPPED) { continue; }
+            DrawGroup &drawGroup = groups[group];
+            if(gpu && drawGroup.command != SKIPPED) {
+                const uint32_t slot = gpuSlot++;
+                ++drawGroup.instanceCount;
+                if(objectsReusable && scene.transformStamp(index) <= frame.uploadedStamp) [[likely]] { continue; }
+                objects[slot] = CullObjectData{.modelMatrix = modelMatrices[index],
+                                               .normalMatrix = normalMatrices[index],
+                                               .sphere = drawGroup.model->boundingSphere(),
+                                               .command = drawGroup.command,
+                                               .instanceBase = drawGroup.firstInstance};
+                firstWritten = std::min(firstWritten, slot);
+                lastWritten = slot;
+                continue;
+            }
+            instances[drawGroup.firstInstance + drawGroup.instanceCount++] = {modelMatrices[index], normalMatrices[index]};
+        }
+        if(gpu) {
+            frame.uploadedStamp = scene.matricesStamp();
+            frame.uploadedCount = gpuObjectCount;
+            frame.uploadedBases.assign(groupBases.begin(), groupBases.end());
+            if(firstWritten <= lastWritten) {
+                frame.objects->flush(C_UI64T(lastWritten - firstWritten + 1) * sizeof(CullObjectData),
+                                     C_UI64T(firstWritten) * sizeof(CullObjectData));
+            }
+        }
+
+        // one command per pooled model; without drawIndirectFirstInstance the instance offset moves into the binding
+        const bool firstInstanceInCommand = lveDevice.features().drawIndirectFirstInstance == VK_TRUE;
+        auto *commands = static_cast<VkDrawIndexedIndirectCommand *>(frame.commands->getMappedMemory());
+        for(const auto &group : groups) {
+            if(group.command == SKIPPED) [[unlikely]] { continue; }
+            const MeshPool::Range *range = group.model->poolRange();
+            commands[group.command] = VkDrawIndexedIndirectCommand{.indexCount = range->indexCount,
+                                                                   .instanceCount = gpu ? 0 : group.instanceCount,
+                                                                   .firstIndex = range->firstIndex,
+                                                                   .vertexOffset = C_I32T(range->vertexOffset),
+                                                                   .firstInstance = firstInstanceInCommand ? group.firstInstance : 0};
+        }
+
+        frame.instances->flush(C_UI64T(instanceCount) * sizeof(Model::InstanceData), 0);
+        frame.commands->flush(C_UI64T(commandCount) * COMMAND_STRIDE, 0);
+    }
+
+    void IndirectRenderSystem::recordCull(const FrameInfo &frameInfo) {
+        FrameResources &frame = frames[C_ST(frameInfo.frameIndex)];
+        frame.gpuTested = gpuObjectCount;
+        if(gpuObjectCount == 0) { return; }
+
+        if(frame.descriptorsDirty) {
+            const auto objectsInfo = frame.objects->descriptorInfo();
+            const auto instancesInfo = frame.instances->descriptorInfo();
+            const auto commandsInfo = frame.commands->descriptorInfo();
+            const auto countersInfo = frame.counters->descriptorInfo();
+            DescriptorWriter(*cullSetLayout, *cullPool)
+                .writeBuffer(0, &objectsInfo)
+                .writeBuffer(1, &instancesInfo)
+                .writeBuffer(2, &commandsInfo)
+                .writeBuffer(3, &countersInfo)
+                .overwrite(frame.cullSet);
+            frame.descriptorsDirty = false;
+        }
+        *static_cast<uint32_t *>(frame.counters->getMappedMemory()) = 0;
+        frame.counters->flush();
+
+        const VkCommandBuffer commandBuffer = frameInfo.commandBuffer;
+        cullPipeline->bind(commandBuffer);
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, cullPipelineLayout, 0, 1, &frame.cullSet, 0, nullptr);
+        const CullPushConstantData push{.planes = frameInfo.camera.getFrustumPlanes(), .objectCount = gpuObjectCount};
+        vkCmdPushConstants(commandBuffer, cullPipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(push), &push);
+        vkCmdDispatch(commandBuffer, (gpuObjectCount + CULL_WORKGROUP_SIZE - 1) / CULL_WORKGROUP_SIZE, 1, 1);
+
+        // NOLINTBEGIN(*-signed-bitwise)
+        const VkMemoryBarrier barrier{
+            .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+            .srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_HOST_READ_BIT,
+        };
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                             VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_HOST_BIT, 0, 1,
+                             &barrier, 0, nullptr, 0, nullptr);
+        // NOLINTEND(*-signed-bitwise)
+    }
+
+    void IndirectRenderSystem::prepare(FrameInfo &frameInfo) {
+#ifdef INDEPTH
+        const vnd::AutoTimer t{"IndirectRenderSystem::prepare", vnd::Timer::Big};
+#endif
+        FrameResources &frame = frames[C_ST(frameInfo.frameIndex)];
+        // the visible counter of the slot's previous frame is final, see Renderer::beginFrame
+        uint32_t gpuVisible = 0;
+        if(cullMode == CullMode::Gpu && frame.gpuTested > 0) {
+            VK_CHECK(frame.counters->invalidate(), "failed to invalidate cull counters!");
+            gpuVisible = *static_cast<const uint32_t *>(frame.counters->getMappedMemory());
+        }
+        const uint32_t gpuTested = frame.gpuTested;
+
+        buildCommands(frameInfo);
+        if(cullMode == CullMode::Gpu) { recordCull(frameInfo); }
+        stats = CullStats{.tested = frame.cpuTested + gpuTested, .visible = frame.cpuVisible + gpuVisible};
+    }
+
+    void IndirectRenderSystem::renderGameObjects(FrameInfo &frameInfo) {
+        if(groups.empty()) { return; }
+
+        const VkCommandBuffer commandBuffer = frameInfo.commandBuffer;
+        lvePipeline->bind(commandBuffer);
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, 1, &frameInfo.globalDescriptorSet, 0,
+                                nullptr);
+
+        const FrameResources &frame = frames[C_ST(frameInfo.frameIndex)];
+        const VkBuffer instanceBuffer = frame.instances->getBuffer();
+        const VkDeviceSize noOffset = 0;
+        vkCmdBindVertexBuffers(commandBuffer, INSTANCE_BINDING, 1, &instanceBuffer, &noOffset);
+
+        if(commandCount > 0) [[likely]] {
+            lveDevice.meshPool().bind(commandBuffer);
+            const VkBuffer indirectBuffer = frame.commands->getBuffer();
+            const auto &features = lveDevice.features();
+            if(features.multiDrawIndirect == VK_TRUE && features.drawIndirectFirstInstance == VK_TRUE) [[likely]] {
+                vkCmdDrawIndexedIndirect(commandBuffer, indirectBuffer, 0, commandCount, COMMAND_STRIDE);
+            } else [[unlikely]] {
+                for(const auto &group : groups) {
+                    if(group.command == SKIPPED) { continue; }
+                    if(features.drawIndirectFirstInstance == VK_FALSE) {
+                        const VkDeviceSize instanceOffset = VkDeviceSize{group.firstInstance} * sizeof(Model::InstanceData);
+                        vkCmdBindVertexBuffers(commandBuffer, INSTANCE_BINDING, 1, &instanceBuffer, &instanceOffset);
+                    }
+                    vkCmdDrawIndexedIndirect(commandBuffer, indirectBuffer, VkDeviceSize{group.command} * COMMAND_STRIDE, 1,
+                                             COMMAND_STRIDE);
+                }
+                vkCmdBindVertexBuffers(commandBuffer, INSTANCE_BINDING, 1, &instanceBuffer, &noOffset);
+            }
+        }
+
+        // models that did not fit into the pool keep their own buffers
+        for(const auto &group : groups) {
+            if(group.command != SKIPPED || group.instanceCount == 0) [[likely]] { continue; }
+            group.model->bind(commandBuffer);
+            group.model->draw(commandBuffer, group.instanceCount, group.firstInstance);
+        }
+    }
+    DISABLE_WARNINGS_POP()
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
@@ -0,0 +1,131 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/MappedFile.hpp"
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace lve {
+    DISABLE_WARNINGS_PUSH(26432 26447 26490)
+
+#ifdef _WIN32
+    MappedFile::MappedFile(const fs::path &path) {
+        fileHandle_ = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if(fileHandle_ == INVALID_HANDLE_VALUE) [[unlikely]] {
+            fileHandle_ = nullptr;
+            throw std::runtime_error(FORMAT("failed to open file for mapping: {}", path.string()));
+        }
+
+        LARGE_INTEGER fileSize{};
+        if(!GetFileSizeEx(fileHandle_, &fileSize)) [[unlikely]] {
+            close();
+            throw std::runtime_error(FORMAT("failed to get file size: {}", path.string()));
+        }
+        size_ = C_ST(fileSize.QuadPart);
+        if(size_ == 0) { return; }
+
+        mappingHandle_ = CreateFileMappingW(fileHandle_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if(mappingHandle_ == nullptr) [[unlikely]] {
+            close();
+            throw std::runtime_error(FORMAT("failed to create file mapping: {}", path.string()));
+        }
+
+        data_ = static_cast<const std::byte *>(MapViewOfFile(mappingHandle_, FILE_MAP_READ, 0, 0, 0));
+        if(data_ == nullptr) [[unlikely]] {
+            close();
+            throw std::runtime_error(FORMAT("failed to map file: {}", path.string()));
+        }
+    }
+
+    void MappedFile::close() noexcept {
+        if(data_ != nullptr) { UnmapViewOfFile(data_); }
+        if(mappingHandle_ != nullptr) { CloseHandle(mappingHandle_); }
+        if(fileHandle_ != nullptr) { CloseHandle(fileHandle_); }
+        data_ = nullptr;
+        size_ = 0;
+        mappingHandle_ = nullptr;
+        fileHandle_ = nullptr;
+    }
+
+    MappedFile::MappedFile(MappedFile &&other) noexcept
+      : data_{std::exchange(other.data_, nullptr)}, size_{std::exchange(other.size_, 0)},
+        fileHandle_{std::exchange(other.fileHandle_, nullptr)}, mappingHandle_{std::exchange(other.mappingHandle_, nullptr)} {}
+
+    MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+        if(this != &other) {
+            close();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            fileHandle_ = std::exchange(other.fileHandle_, nullptr);
+            mappingHandle_ = std::exchange(other.mappingHandle_, nullptr);
+        }
+        return *this;
+    }
+#else
+    MappedFile::MappedFile(const fs::path &path) {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if(fd < 0) [[unlikely]] { throw std::runtime_error(FORMAT("failed to open file for mapping: {}", path.string())); }
+
+        struct stat fileStat {};
+        if(::fstat(fd, &fileStat) != 0) [[unlikely]] {
+            ::close(fd);
+            throw std::runtime_error(FORMAT("failed to get file size: {}", path.string()));
+        }
+        size_ = C_ST(fileStat.st_size);
+        if(size_ == 0) {
+            ::close(fd);
+            return;
+        }
+
+        void *mapping = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        // the mapping keeps its own reference to the file
+        ::close(fd);
+        if(mapping == MAP_FAILED) [[unlikely]] {
+            size_ = 0;
+            throw std::runtime_error(FORMAT("failed to map file: {}", path.string()));
+        }
+        ::madvise(mapping, size_, MADV_SEQUENTIAL);
+        data_ = static_cast<const std::byte *>(mapping);
+    }
+
+    void MappedFile::close() noexcept {
+        if(data_ != nullptr) {
+            // NOLINTNEXTLINE(*-const-cast)
+            ::munmap(const_cast<std::byte *>(data_), size_);
+        }
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    MappedFile::MappedFile(MappedFile &&other) noexcept
+      : data_{std::exchange(other.data_, nullptr)}, size_{std::exchange(other.size_, 0)} {}
+
+    MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+        if(this != &other) {
+            close();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+#endif
+
+    MappedFile::~MappedFile() { close(); }
+
+    DISABLE_WARNINGS_POP()
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
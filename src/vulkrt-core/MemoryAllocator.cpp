@@ -0,0 +1,272 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/MemoryAllocator.hpp"
+
+namespace lve {
+    namespace {
+        [[nodiscard]] constexpr VkDeviceSize alignUp(VkDeviceSize value, VkDeviceSize alignment) noexcept {
+            return alignment <= 1 ? value : (value + alignment - 1) / alignment * alignment;
+        }
+
+        [[nodiscard]] constexpr VkDeviceSize alignDown(VkDeviceSize value, VkDeviceSize alignment) noexcept {
+            return alignment <= 1 ? value : value / alignment * alignment;
+        }
+
+        [[nodiscard]] constexpr double toMiB(VkDeviceSize bytes) noexcept { return C_D(bytes) / (1024.0 * 1024.0); }
+    }  // namespace
+
+    DISABLE_WARNINGS_PUSH(26446 26482)
+    MemoryAllocator::MemoryAllocator(VkPhysicalDevice physicalDevice, VkDevice device, VkDeviceSize blockSize)
+      : device{device}, blockSize{blockSize} {
+        vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memoryProperties);
+        VkPhysicalDeviceProperties properties{};
+        vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+        nonCoherentAtomSize = std::max(VkDeviceSize{1}, properties.limits.nonCoherentAtomSize);
+        pools.resize(C_ST(memoryProperties.memoryTypeCount) * 2);
+    }
+
+    MemoryAllocator::~MemoryAllocator() {
+        if(allocationCount != 0) [[unlikely]] { LWARN("MemoryAllocator destroyed with {} live allocations", allocationCount); }
+        for(auto &pool : pools) {
+            for(const auto &block : pool.blocks) {
+                if(block.memory != VK_NULL_HANDLE) { vkFreeMemory(device, block.memory, nullptr); }
+            }
+        }
+    }
+
+    uint32_t MemoryAllocator::findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties) const {
+        for(uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++) {
+            if((typeFilter & (1U << i)) && (memoryProperties.memoryTypes[i].propertyFlags & properties) == properties) { return i; }
+        }
+        throw std::runtime_error("failed to find suitable memory type!");
+    }
+
+    bool MemoryAllocator::isHostVisible(uint32_t memoryType) const noexcept {
+        return (memoryProperties.memoryTypes[memoryType].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0;
+    }
+
+    bool MemoryAllocator::isNonCoherent(uint32_t memoryType) const noexcept {
+        return isHostVisible(memoryType) &&
+               (memoryProperties.memoryTypes[memoryType].propertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) == 0;
+    }
+
+    VkDeviceMemory MemoryAllocator::allocateMemory(VkDeviceSize size, uint32_t memoryType, std::byte *&mapped) {
+        const VkMemoryAllocateInfo allocInfo = {
+            .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO, .allocationSize = size, .memoryTypeIndex = memoryType};
+
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+        VK_CHECK(vkAllocateMemory(device, &allocInfo, nullptr, &memory), "failed to allocate device memory block!");
+
+        mapped = nullptr;
+        if(isHostVisible(memoryType)) {
+            void *data = nullptr;
+            const VkResult result = vkMapMemory(device, memory, 0, VK_WHOLE_SIZE, 0, &data);
+            if(result != VK_SUCCESS) [[unlikely]] {
+                vkFreeMemory(device, memory, nullptr);
+                VK_CHECK(result, "failed to map device memory block!");
+            }
+            mapped = static_cast<std::byte *>(data);
+        }
+        return memory;
+    }
+
+    bool MemoryAllocator::tryAllocate(Block &block, VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize &offset) noexcept {
+        auto best = block.freeRanges.end();
+        VkDeviceSize bestWaste = std::numeric_limits<VkDeviceSize>::max();
+        for(auto it = block.freeRanges.begin(); it != block.freeRanges.end(); ++it) {
+            const VkDeviceSize aligned = alignUp(it->offset, alignment);
+            if(aligned + size > it->offset + it->size) { continue; }
+            const VkDeviceSize waste = it->size - size;
+            if(waste < bestWaste) {
+                best = it;
+                bestWaste = waste;
+                if(waste == 0) { break; }
+            }
+        }
+        if(best == block.freeRanges.end()) { return false; }
+
+        const Range range = *best;
+        offset = alignUp(range.offset, alignment);
+        const Range front{range.offset, offset - range.offset};
+        const Range back{offset + size, range.offset + range.size - (offset + size)};
+        if(front.size != 0 && back.size != 0) {
+            *best = front;
+            block.freeRanges.insert(best + 1, back);
+        } else if(front.size != 0) {
+            *best = front;
+        } else if(back.size != 0) {
+            *best = back;
+        } else {
+            block.freeRanges.erase(best);
+        }
+        return true;
+    }
+
+    void MemoryAllocator::release(Block &block, Range range) noexcept {
+        auto next = std::ranges::lower_bound(block.freeRanges, range.offset, {}, &Range::offset);
+        if(next != block.freeRanges.begin()) {
+            auto prev = std::prev(next);
+            if(prev->offset + prev->size == range.offset) {
+                prev->size += range.size;
+                if(next != block.freeRanges.end() && prev->offset + prev->size == next->offset) {
+                    prev->size += next->size;
+                    block.freeRanges.erase(next);
+                }
+                return;
+            }
+        }
+        if(next != block.freeRanges.end() && range.offset + range.size == next->offset) {
+            next->offset = range.offset;
+            next->size += range.size;
+            return;
+        }
+        block.freeRanges.insert(next, range);
+    }
+
+    Allocation MemoryAllocator::allocate(const VkMemoryRequirements &requirements, VkMemoryPropertyFlags properties, bool optimalImage) {
+        const std::scoped_lock lock{mutex};
+        const uint32_t memoryType = findMemoryType(requirements.memoryTypeBits, properties);
+        VkDeviceSize size = requirements.size;
+        VkDeviceSize alignment = std::max(VkDeviceSize{1}, requirements.alignment);
+        if(isNonCoherent(memoryType)) {
+            // keep every flushable range atom aligned so flushes never touch a neighbour
+            alignment = std::max(alignment, nonCoherentAtomSize);
+            size = alignUp(size, nonCoherentAtomSize);
+        }
+
+        Allocation allocation{};
+        allocation.memoryType = memoryType;
+        allocation.pool = memoryType * 2 + (optimalImage ? 1U : 0U);
+        allocation.size = size;
+
+        // small heaps (e.g. the 256 MiB BAR window) would be exhausted by a few full size blocks
+        const VkDeviceSize heapSize = memoryProperties.memoryHeaps[memoryProperties.memoryTypes[memoryType].heapIndex].size;
+        const VkDeviceSize poolBlockSize = std::min(blockSize, std::max(heapSize / 8, VkDeviceSize{1} << 20));
+
+        if(size > poolBlockSize / 2) {
+            std::byte *mapped = nullptr;
+            allocation.memory = allocateMemory(size, memoryType, mapped);
+            allocation.mapped = mapped;
+            dedicatedBytes += size;
+            ++dedicatedCount;
+        } else {
+            Pool &pool = pools[allocation.pool];
+            std::optional<std::size_t> emptySlot{};
+            for(std::size_t i = 0; i < pool.blocks.size() && !allocation.isValid(); ++i) {
+                Block &block = pool.blocks[i];
+                if(block.memory == VK_NULL_HANDLE) {
+                    if(!emptySlot) { emptySlot = i; }
+                    continue;
+                }
+                if(tryAllocate(block, size, alignment, allocation.offset)) {
+                    allocation.memory = block.memory;
+                    allocation.block = C_UI32T(i);
+                }
+            }
+            if(!allocation.isValid()) {
+                const std::size_t index = emptySlot.value_or(pool.blocks.size());
+                if(index == pool.blocks.size()) { pool.blocks.emplace_back(); }
+                Block &block = pool.blocks[index];
+                block.memory = allocateMemory(poolBlockSize, memoryType, block.mapped);
+                block.size = poolBlockSize;
+                block.freeRanges = {Range{0, poolBlockSize}};
+                [[maybe_unused]] const bool fits = tryAllocate(block, size, alignment, allocation.offset);
+                assert(fits && "fresh block must fit a request of at most half its size");
+                allocation.memory = block.memory;
+                allocation.block = C_UI32T(index);
+            }
+            Block &block = pool.blocks[allocation.block];
+            ++block.allocationCount;
+            if(block.mapped != nullptr) { allocation.mapped = block.mapped + allocation.offset; }
+        }
+
+        usedBytes += size;
+        ++allocationCount;
+        return allocation;
+    }
+
+    void MemoryAllocator::free(Allocation &allocation) noexcept {
+        if(!allocation.isValid()) { return; }
+        const std::scoped_lock lock{mutex};
+        if(allocation.isDedicated()) {
+            vkFreeMemory(device, allocation.memory, nullptr);
+            dedicatedBytes -= allocation.size;
+            --dedicatedCount;
+        } else {
+            Pool &pool = pools[allocation.pool];
+            Block &block = pool.blocks[allocation.block];
+            release(block, Range{allocation.offset, allocation.size});
+            // give an empty block back to the driver unless it is the last one of its pool
+            if(--block.allocationCount == 0) {
+                const auto live = std::ranges::count_if(pool.blocks, [](const Block &other) { return other.memory != VK_NULL_HANDLE; });
+                if(live > 1) {
+                    vkFreeMemory(device, block.memory, nullptr);
+                    block = Block{};
+                }
+            }
+        }
+        usedBytes -= allocation.size;
+        --allocationCount;
+        allocation = Allocation{};
+    }
+
+    VkMappedMemoryRange MemoryAllocator::mappedRange(const Allocation &allocation, VkDeviceSize offset,
+                                                     VkDeviceSize size) const noexcept {
+        const VkDeviceSize begin = allocation.offset + offset;
+        const VkDeviceSize end = size == VK_WHOLE_SIZE ? allocation.offset + allocation.size : begin + size;
+        // allocations of non-coherent memory are atom aligned and padded, so widening never leaves the allocation
+        const VkDeviceSize alignedBegin = alignDown(begin, nonCoherentAtomSize);
+        const VkDeviceSize alignedEnd = std::min(alignUp(end, nonCoherentAtomSize), allocation.offset + allocation.size);
+        return VkMappedMemoryRange{.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
+                                   .memory = allocation.memory,
+                                   .offset = alignedBegin,
+                                   .size = alignedEnd - alignedBegin};
+    }
+
+    VkResult MemoryAllocator::flush(const Allocation &allocation, VkDeviceSize offset, VkDeviceSize size) const noexcept {
+        if(!allocation.isValid() || !isNonCoherent(allocation.memoryType)) { return VK_SUCCESS; }
+        const VkMappedMemoryRange range = mappedRange(allocation, offset, size);
+        return vkFlushMappedMemoryRanges(device, 1, &range);
+    }
+
+    VkResult MemoryAllocator::invalidate(const Allocation &allocation, VkDeviceSize offset, VkDeviceSize size) const noexcept {
+        if(!allocation.isValid() || !isNonCoherent(allocation.memoryType)) { return VK_SUCCESS; }
+        const VkMappedMemoryRange range = mappedRange(allocation, offset, size);
+        return vkInvalidateMappedMemoryRanges(device, 1, &range);
+    }
+
+    MemoryAllocator::Stats MemoryAllocator::stats() const {
+        const std::scoped_lock lock{mutex};
+        Stats stats{};
+        stats.reservedBytes = dedicatedBytes;
+        stats.usedBytes = usedBytes;
+        stats.dedicatedCount = dedicatedCount;
+        stats.allocationCount = allocationCount;
+        for(const auto &pool : pools) {
+            for(const auto &block : pool.blocks) {
+                if(block.memory == VK_NULL_HANDLE) { continue; }
+                ++stats.blockCount;
+                stats.reservedBytes += block.size;
+                for(const auto &range : block.freeRanges) {
+                    stats.freeBytes += range.size;
+                    stats.largestFreeRange = std::max(stats.largestFreeRange, range.size);
+                    ++stats.freeRangeCount;
+                }
+            }
+        }
+        return stats;
+    }
+
+    void MemoryAllocator::logStats() const {
+        const Stats s = stats();
+        LINFO("device memory: {} allocations in {} blocks + {} dedicated, {:.2f} MiB used / {:.2f} MiB reserved, {} free ranges, "
+              "fragmentation {:.2f}",
+              s.allocationCount, s.blockCount, s.dedicatedCount, toMiB(s.usedBytes), toMiB(s.reservedBytes), s.freeRangeCount,
+              s.fragmentation());
+    }
+    DISABLE_WARNINGS_POP()
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
@@ -0,0 +1,129 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/MeshCache.hpp"
+#include "vulkrt/Util.hpp"
+
+#include <vulkrt/timer/Timer.hpp>
+
+namespace lve {
+    static inline constexpr auto HEADER_SIZE = sizeof(MeshCache::Header);
+    static inline constexpr auto VERTEX_SIZE = sizeof(Model::Vertex);
+    static inline constexpr auto INDEX_SIZE = sizeof(uint32_t);
+    static_assert(std::is_trivially_copyable_v<Model::Vertex>, "Model::Vertex must be trivially copyable to be cached");
+    static_assert(std::is_trivially_copyable_v<MeshCache::Header>, "MeshCache::Header must be trivially copyable");
+    static_assert(HEADER_SIZE % alignof(Model::Vertex) == 0, "vertex data must stay aligned after the header");
+
+    DISABLE_WARNINGS_PUSH(26446 26481 26490)
+    fs::path MeshCache::cachePathFor(const fs::path &sourcePath) {
+        fs::path cachePath = sourcePath;
+        cachePath += EXTENSION;
+        return cachePath;
+    }
+
+    MeshCache::Header MeshCache::makeHeader(const fs::path &sourcePath) {
+        Header header{};
+        header.sourceSize = C_UI64T(fs::file_size(sourcePath));
+        header.sourceMtime = C_I64T(fs::last_write_time(sourcePath).time_since_epoch().count());
+        header.sourcePathHash = fnv1a64(fs::absolute(sourcePath).lexically_normal().generic_string());
+        return header;
+    }
+
+    std::optional<MeshCache::View> MeshCache::open(const fs::path &sourcePath) noexcept {
+        try {
+            const auto cachePath = cachePathFor(sourcePath);
+            if(!fs::exists(cachePath)) { return std::nullopt; }
+#ifdef INDEPTH
+            const vnd::AutoTimer t{FORMAT("MeshCache::open {}", cachePath.string()), vnd::Timer::Big};
+#endif
+            View view{};
+            view.file_ = MappedFile{cachePath};
+            const auto bytes = view.file_.bytes();
+            if(bytes.size() < HEADER_SIZE) [[unlikely]] {
+                LWARN("mesh cache {} is truncated, rebuilding", cachePath.string());
+                return std::nullopt;
+            }
+
+            Header header{};
+            std::memcpy(&header, bytes.data(), HEADER_SIZE);
+            const Header expected = makeHeader(sourcePath);
+            if(header.magic != MAGIC || header.version != VERSION || header.vertexSize != VERTEX_SIZE || header.indexSize != INDEX_SIZE)
+                [[unlikely]] {
+                LWARN("mesh cache {} has an incompatible format, rebuilding", cachePath.string());
+                return std::nullopt;
+            }
+            if(header.sourceSize != expected.sourceSize || header.sourceMtime != expected.sourceMtime ||
+               header.sourcePathHash != expected.sourcePathHash) {
+                LINFO("mesh cache {} is stale, rebuilding", cachePath.string());
+                return std::nullopt;
+            }
+
+            // bound the counts by the payload before multiplying, a corrupt header must not wrap the size check around
+            const auto payloadSize = C_UI64T(bytes.size() - HEADER_SIZE);
+            if(header.vertexCount > payloadSize / VERTEX_SIZE || header.indexCount > payloadSize / INDEX_SIZE) [[unlikely]] {
+                LWARN("mesh cache {} counts exceed its size, rebuilding", cachePath.string());
+                return std::nullopt;
+            }
+            const auto vertexBytes = header.vertexCount * VERTEX_SIZE;
+            const auto indexBytes = header.indexCount * INDEX_SIZE;
+            if(payloadSize != vertexBytes + indexBytes) [[unlikely]] {
+                LWARN("mesh cache {} size does not match its header, rebuilding", cachePath.string());
+                return std::nullopt;
+            }
+
+            // the mapping is page aligned and the header size keeps both arrays naturally aligned
+            const auto *vertexData = bytes.data() + HEADER_SIZE;
+            const auto *indexData = vertexData + vertexBytes;
+            view.vertices_ = {std::bit_cast<const Model::Vertex *>(vertexData), C_ST(header.vertexCount)};
+            view.indices_ = {std::bit_cast<const uint32_t *>(indexData), C_ST(header.indexCount)};
+            return view;
+        } catch(const std::exception &e) {
+            LWARN("failed to open mesh cache for {}: {}", sourcePath.string(), e.what());
+            return std::nullopt;
+        }
+    }
+
+    void MeshCache::store(const fs::path &sourcePath, std::span<const Model::Vertex> vertices, std::span<const uint32_t> indices) noexcept {
+        try {
+            const auto cachePath = cachePathFor(sourcePath);
+            auto tmpPath = cachePath;
+            tmpPath += ".tmp";
+#ifdef INDEPTH
+            const vnd::AutoTimer t{FORMAT("MeshCache::store {}", cachePath.string()), vnd::Timer::Big};
+#endif
+            Header header = makeHeader(sourcePath);
+            header.vertexCount = vertices.size();
+            header.indexCount = indices.size();
+
+            {
+                std::ofstream out{tmpPath, std::ios::binary | std::ios::trunc};  // NOLINT(*-signed-bitwise)
+                if(!out.is_open()) [[unlikely]] { throw std::runtime_error(FORMAT("failed to open {}", tmpPath.string())); }
+                out.write(std::bit_cast<const char *>(&header), C_LL(HEADER_SIZE));
+                out.write(std::bit_cast<const char *>(vertices.data()), C_LL(vertices.size_bytes()));
+                out.write(std::bit_cast<const char *>(indices.data()), C_LL(indices.size_bytes()));
+                if(!out) [[unlikely]] { throw std::runtime_error(FORMAT("failed to write {}", tmpPath.string())); }
+            }
+            // write-then-rename so a concurrent reader never maps a half written file
+            fs::rename(tmpPath, cachePath);
+        } catch(const std::exception &e) { LWARN("failed to write mesh cache for {}: {}", sourcePath.string(), e.what()); }
+    }
+    DISABLE_WARNINGS_POP()
+
+    MeshCache::Mesh MeshCache::load(const std::string &sourcePath) {
+        Mesh mesh{};
+        // a valid cache is mapped and copied straight into the staging ring, skipping the OBJ import
+        mesh.cached = open(sourcePath);
+        if(mesh.cached) {
+            LINFO("{} vertex count: {} (cached)", sourcePath, mesh.cached->vertices().size());
+            return mesh;
+        }
+
+        mesh.builder.loadModel(sourcePath);
+        LINFO("{} vertex count: {}", sourcePath, mesh.builder.vertices.size());
+        store(sourcePath, mesh.builder.vertices, mesh.builder.indices);
+        return mesh;
+    }
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
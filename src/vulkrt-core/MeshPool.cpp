@@ -0,0 +1,119 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/MeshPool.hpp"
+#include "vulkrt/SwapChain.hpp"
+
+namespace lve {
+    DISABLE_WARNINGS_PUSH(26446 26482)
+    bool MeshPool::FreeList::allocate(uint32_t count, uint32_t &offset) {
+        const auto it = std::ranges::find_if(spans, [count](const Span &span) { return span.count >= count; });
+        if(it == spans.end()) [[unlikely]] { return false; }
+        offset = it->offset;
+        if(it->count == count) {
+            spans.erase(it);
+        } else {
+            it->offset += count;
+            it->count -= count;
+        }
+        freeCount -= count;
+        return true;
+    }
+
+    void MeshPool::FreeList::release(Span span) {
+        freeCount += span.count;
+        auto next = std::ranges::lower_bound(spans, span.offset, {}, &Span::offset);
+        if(next != spans.begin()) {
+            if(auto prev = std::prev(next); prev->offset + prev->count == span.offset) {
+                prev->count += span.count;
+                if(next != spans.end() && prev->offset + prev->count == next->offset) {
+                    prev->count += next->count;
+                    spans.erase(next);
+                }
+                return;
+            }
+        }
+        if(next != spans.end() && span.offset + span.count == next->offset) {
+            next->offset = span.offset;
+            next->count += span.count;
+            return;
+        }
+        spans.insert(next, span);
+    }
+
+    MeshPool::MeshPool(Device &device, VkDeviceSize vertexStride, uint32_t vertexCapacity, uint32_t indexCapacity)
+      : lveDevice{device}, vertexStride{vertexStride}, freeVertices{vertexCapacity}, freeIndices{indexCapacity} {
+        // frames in flight read the pool while the transfer queue copies new meshes into other ranges, so both families share it
+        // NOLINTBEGIN(*-signed-bitwise)
+        vertices = MAKE_UNIQUE(Buffer, lveDevice, vertexStride, vertexCapacity,
+                               VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 1,
+                               VK_SHARING_MODE_CONCURRENT);
+        indices = MAKE_UNIQUE(Buffer, lveDevice, sizeof(uint32_t), indexCapacity,
+                              VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 1,
+                              VK_SHARING_MODE_CONCURRENT);
+        // NOLINTEND(*-signed-bitwise)
+        LINFO("mesh pool: {} vertices of {} bytes, {} indices", vertexCapacity, vertexStride, indexCapacity);
+    }
+
+    std::optional<MeshPool::Range> MeshPool::allocate(uint32_t vertexCount, uint32_t indexCount) {
+        std::scoped_lock lock{mutex};
+        Range range{.vertexCount = vertexCount, .indexCount = indexCount};
+        if(!freeVertices.allocate(vertexCount, range.vertexOffset)) [[unlikely]] { return std::nullopt; }
+        if(!freeIndices.allocate(indexCount, range.firstIndex)) [[unlikely]] {
+            freeVertices.release(Span{range.vertexOffset, vertexCount});
+            return std::nullopt;
+        }
+        ++meshCount;
+        return range;
+    }
+
+    void MeshPool::free(const Range &range) {
+        std::scoped_lock lock{mutex};
+        // the upper bound keeps the pool independent of the renderer's setting at the cost of a few frames of latency
+        retired.emplace_back(Retired{range, frameCounter + SwapChain::MAX_FRAMES_IN_FLIGHT});
+    }
+
+    UploadToken MeshPool::upload(const Range &range, const void *vertexData, std::span<const uint32_t> indexData) {
+        assert(indexData.size() == range.indexCount && "index count does not match the range");
+        StagingRing &staging = lveDevice.staging();
+        const UploadToken vertexToken = staging.upload(vertices->getBuffer(), range.vertexOffset * vertexStride, vertexData,
+                                                       range.vertexCount * vertexStride, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT,
+                                                       VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT, VK_SHARING_MODE_CONCURRENT);
+        const UploadToken indexToken = staging.upload(indices->getBuffer(), VkDeviceSize{range.firstIndex} * sizeof(uint32_t),
+                                                      indexData.data(), indexData.size_bytes(), VK_PIPELINE_STAGE_VERTEX_INPUT_BIT,
+                                                      VK_ACCESS_INDEX_READ_BIT, VK_SHARING_MODE_CONCURRENT);
+        return max(vertexToken, indexToken);
+    }
+
+    void MeshPool::endFrame() {
+        std::scoped_lock lock{mutex};
+        ++frameCounter;
+        const auto done = std::ranges::partition(retired, [this](const Retired &entry) { return entry.frame >= frameCounter; });
+        for(const Retired &entry : done) {
+            freeVertices.release(Span{entry.range.vertexOffset, entry.range.vertexCount});
+            freeIndices.release(Span{entry.range.firstIndex, entry.range.indexCount});
+            --meshCount;
+        }
+        retired.erase(done.begin(), done.end());
+    }
+
+    void MeshPool::bind(VkCommandBuffer commandBuffer) const noexcept {
+        const VkBuffer buffer = vertices->getBuffer();
+        const VkDeviceSize offset = 0;
+        vkCmdBindVertexBuffers(commandBuffer, 0, 1, &buffer, &offset);
+        vkCmdBindIndexBuffer(commandBuffer, indices->getBuffer(), 0, VK_INDEX_TYPE_UINT32);
+    }
+
+    MeshPool::Stats MeshPool::stats() const {
+        std::scoped_lock lock{mutex};
+        return Stats{.vertexCapacity = vertices->getInstanceCount(),
+                     .indexCapacity = indices->getInstanceCount(),
+                     .usedVertices = freeVertices.used(),
+                     .usedIndices = freeIndices.used(),
+                     .meshCount = meshCount};
+    }
+    DISABLE_WARNINGS_POP()
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
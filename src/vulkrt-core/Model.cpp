@@ -3,26 +3,36 @@
 //
 // NOLINTBEGIN(*-include-cleaner)
 #include "vulkrt/Model.hpp"
-#include "vulkrt/Util.hpp"
+#include "vulkrt/MeshCache.hpp"
+#include "vulkrt/ObjReader.hpp"
+#include "vulkrt/VertexDedup.hpp"
 #include "vulkrt/tiny_obj_loader.h"
 
 #include <vulkrt/timer/Timer.hpp>
 
-namespace std {
-    template <> struct hash<lve::Model::Vertex> {
-        size_t operator()(lve::Model::Vertex const &vertex) const noexcept {
-            size_t seed = 0;
-            lve::hashCombine(seed, vertex.position, vertex.color, vertex.normal, vertex.uv);
-            return seed;
-        }
-    };
-}  // namespace std
-
 namespace lve {
     DISABLE_WARNINGS_PUSH(26432 26447)
-    Model::Model(Device &device, const Model::Builder &builder) noexcept : lveDevice{device} {
-        createVertexBuffers(builder.vertices);
-        createIndexBuffers(builder.indices);
+    Model::Model(Device &device, const Model::Builder &builder) noexcept
+      : Model{device, builder.vertices, builder.indices, builder.bounds} {}
+
+    Model::Model(Device &device, std::span<const Vertex> vertices, std::span<const uint32_t> indices) noexcept
+      : Model{device, vertices, indices, Bounds::fromVertices(vertices)} {}
+
+    Model::Model(Device &device, std::span<const Vertex> vertices, std::span<const uint32_t> indices, const Bounds &bounds) noexcept
+      : lveDevice{device}, objectBounds{bounds} {
+        if(!indices.empty()) [[likely]] {
+            pooledRange = lveDevice.meshPool().allocate(C_UI32T(vertices.size()), C_UI32T(indices.size()));
+        }
+        if(pooledRange) [[likely]] {
+            createPooledBuffers(vertices, indices);
+            return;
+        }
+        createVertexBuffers(vertices);
+        createIndexBuffers(indices);
+    }
+
+    Model::~Model() {
+        if(pooledRange) [[likely]] { lveDevice.meshPool().free(*pooledRange); }
     }
     DISABLE_WARNINGS_POP()
     DISABLE_WARNINGS_PUSH(26446)
@@ -44,54 +54,89 @@ namespace lve {
 
         return attributeDescriptions;
     }
-    void Model::bind(VkCommandBuffer commandBuffer) noexcept {
+    static inline constexpr uint32_t INSTANCE_FIRST_LOCATION = 4;
+    VkVertexInputBindingDescription Model::InstanceData::getBindingDescription(uint32_t binding) {
+        return VkVertexInputBindingDescription{binding, C_UI32T(sizeof(InstanceData)), VK_VERTEX_INPUT_RATE_INSTANCE};
+    }
+    std::vector<VkVertexInputAttributeDescription> Model::InstanceData::getAttributeDescriptions(uint32_t binding) {
+        std::vector<VkVertexInputAttributeDescription> attributeDescriptions{};
+        // a mat4 attribute takes four consecutive locations, both matrices are read column by column
+        for(uint32_t column = 0; column < 8; ++column) {
+            attributeDescriptions.emplace_back(VkVertexInputAttributeDescription{INSTANCE_FIRST_LOCATION + column, binding,
+                                                                                 VK_FORMAT_R32G32B32A32_SFLOAT,
+                                                                                 C_UI32T(column * sizeof(glm::vec4))});
+        }
+        return attributeDescriptions;
+    }
+    void Model::bind(VkCommandBuffer commandBuffer) const noexcept {
+        if(pooledRange) [[likely]] {
+            lveDevice.meshPool().bind(commandBuffer);
+            return;
+        }
         const std::array<VkBuffer, 1> buffers = {vertexBuffer->getBuffer()};
         const std::array<VkDeviceSize, 1> offsets = {0};
         vkCmdBindVertexBuffers(commandBuffer, 0, 1, buffers.data(), offsets.data());
         if(hasIndexBuffer) [[likely]] { vkCmdBindIndexBuffer(commandBuffer, indexBuffer->getBuffer(), 0, VK_INDEX_TYPE_UINT32); }
     }
-    void Model::draw(VkCommandBuffer commandBuffer) const noexcept {
-        if(hasIndexBuffer) [[likely]] {
-            vkCmdDrawIndexed(commandBuffer, indexCount, 1, 0, 0, 0);
+    void Model::draw(VkCommandBuffer commandBuffer, uint32_t instanceCount, uint32_t firstInstance) const noexcept {
+        if(pooledRange) [[likely]] {
+            vkCmdDrawIndexed(commandBuffer, indexCount, instanceCount, pooledRange->firstIndex, C_I32T(pooledRange->vertexOffset),
+                             firstInstance);
+        } else if(hasIndexBuffer) {
+            vkCmdDrawIndexed(commandBuffer, indexCount, instanceCount, 0, 0, firstInstance);
         } else [[unlikely]] {
-            vkCmdDraw(commandBuffer, vertexCount, 1, 0, 0);
+            vkCmdDraw(commandBuffer, vertexCount, instanceCount, 0, firstInstance);
         }
     }
 
     std::unique_ptr<Model> Model::createModelFromFile(Device &device, const std::string &filepath) {
-        Builder builder{};
-        builder.loadModel(filepath);
-        LINFO("{} vertex count: {}", filepath, builder.vertices.size());
-        return MAKE_UNIQUE(Model, device, builder);
+        const auto mesh = MeshCache::load(filepath);
+        return MAKE_UNIQUE(Model, device, mesh.vertices(), mesh.indices());
     }
 
-    void Model::createVertexBuffers(const std::vector<Vertex> &vertices) {
+    Model::Bounds Model::Bounds::fromVertices(std::span<const Vertex> vertices) noexcept {
+        if(vertices.empty()) [[unlikely]] { return Bounds{}; }
+        // centered on the AABB: not minimal, but one pass for the box and one for the radius
+        glm::vec3 lo{vertices.front().position};
+        glm::vec3 hi{lo};
+        for(const auto &vertex : vertices) {
+            lo = glm::min(lo, vertex.position);
+            hi = glm::max(hi, vertex.position);
+        }
+        const glm::vec3 center = (lo + hi) * 0.5F;
+        float radiusSquared = 0.0F;
+        for(const auto &vertex : vertices) {
+            const glm::vec3 offset = vertex.position - center;
+            radiusSquared = std::max(radiusSquared, glm::dot(offset, offset));
+        }
+        return Bounds{.min = lo, .max = hi, .sphere = glm::vec4{center, std::sqrt(radiusSquared)}};
+    }
+
+    void Model::createPooledBuffers(std::span<const Vertex> vertices, std::span<const uint32_t> indices) {
+        vertexCount = C_UI32T(vertices.size());
+        assert(vertexCount >= 3 && "Vertex count must be at least 3");
+        indexCount = C_UI32T(indices.size());
+        hasIndexBuffer = true;
+        uploadToken = lveDevice.meshPool().upload(*pooledRange, vertices.data(), indices);
+    }
+
+    void Model::createVertexBuffers(std::span<const Vertex> vertices) {
         vertexCount = C_UI32T(vertices.size());
         assert(vertexCount >= 3 && "Vertex count must be at least 3");
         uint32_t vertexSize = sizeof(vertices[0]);
         const VkDeviceSize bufferSize = static_cast<VkDeviceSize>(vertexSize) * vertexCount;
 
         // NOLINTBEGIN(*-signed-bitwise)
-        Buffer stagingBuffer{
-            lveDevice,
-            vertexSize,
-            vertexCount,
-            VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-        };
-
-        stagingBuffer.map();
-        stagingBuffer.writeToBuffer(std::bit_cast<void *>(vertices.data()));
-
         vertexBuffer = std::make_unique<Buffer>(lveDevice, vertexSize, vertexCount,
                                                 VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
                                                 VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
         // NOLINTEND(*-signed-bitwise)
 
-        lveDevice.copyBuffer(stagingBuffer.getBuffer(), vertexBuffer->getBuffer(), bufferSize);
+        uploadToken = max(uploadToken, lveDevice.staging().upload(vertexBuffer->getBuffer(), 0, vertices.data(), bufferSize,
+                                                                  VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT));
     }
 
-    void Model::createIndexBuffers(const std::vector<uint32_t> &indices) {
+    void Model::createIndexBuffers(std::span<const uint32_t> indices) {
         indexCount = C_UI32T(indices.size());
         hasIndexBuffer = indexCount > 0;
 
@@ -101,29 +146,28 @@ namespace lve {
         const VkDeviceSize bufferSize = static_cast<VkDeviceSize>(indexSize) * indexCount;
 
         // NOLINTBEGIN(*-signed-bitwise)
-        Buffer stagingBuffer{
-            lveDevice,
-            indexSize,
-            indexCount,
-            VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-        };
-
-        stagingBuffer.map();
-        stagingBuffer.writeToBuffer(std::bit_cast<void *>(indices.data()));
-
         indexBuffer = std::make_unique<Buffer>(lveDevice, indexSize, indexCount,
                                                VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
                                                VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
         // NOLINTEND(*-signed-bitwise)
 
-        lveDevice.copyBuffer(stagingBuffer.getBuffer(), indexBuffer->getBuffer(), bufferSize);
+        uploadToken = max(uploadToken, lveDevice.staging().upload(indexBuffer->getBuffer(), 0, indices.data(), bufferSize,
+                                                                  VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, VK_ACCESS_INDEX_READ_BIT));
     }
 
-    void Model::Builder::loadModel(const std::string &filepath) {
+    void Model::Builder::loadModel(const std::string &filepath, ObjLoader loader) {
 #ifdef INDEPTH
         const vnd::AutoTimer t{FORMAT("loadModel {}", filepath), vnd::Timer::Big};
 #endif
+        if(loader == ObjLoader::Streaming) [[likely]] {
+            ObjReader::read(filepath, vertices, indices);
+        } else {
+            loadModelTinyObj(filepath);
+        }
+        bounds = Bounds::fromVertices(vertices);
+    }
+
+    void Model::Builder::loadModelTinyObj(const std::string &filepath) {
         tinyobj::attrib_t attrib;
         std::vector<tinyobj::shape_t> shapes;
         std::vector<tinyobj::material_t> materials;
@@ -133,39 +177,45 @@ namespace lve {
             throw std::runtime_error(warn + err);
         }
 
-        vertices.clear();
-        indices.clear();
-
-        std::unordered_map<Vertex, uint32_t> uniqueVertices{};
-        uniqueVertices.reserve(shapes.size() * 3);
-        std::for_each(std::execution::par, shapes.begin(), shapes.end(), [&](const auto &shape) {
-            for(const auto &index : shape.mesh.indices) {
-                Vertex vertex{};
-                const auto vertex_index = 3 * index.vertex_index;
-
-                if(index.vertex_index >= 0) [[likely]] {
-                    vertex.position = {attrib.vertices[vertex_index], attrib.vertices[vertex_index + 1], attrib.vertices[vertex_index + 2]};
-
-                    vertex.color = {attrib.colors[vertex_index], attrib.colors[vertex_index + 1], attrib.colors[vertex_index + 2]};
-                }
-
-                if(index.normal_index >= 0) [[likely]] {
-                    const auto normal_index = 3 * index.normal_index;
-                    vertex.normal = {attrib.normals[normal_index], attrib.normals[normal_index + 1], attrib.normals[normal_index + 2]};
-                }
-
-                if(index.texcoord_index >= 0) [[likely]] {
-                    const auto texcoord_index = 2 * index.texcoord_index;
-                    vertex.uv = {attrib.texcoords[texcoord_index], attrib.texcoords[texcoord_index + 1]};
-                }
-
-                if(uniqueVertices.count(vertex) == 0) [[likely]] {
-                    uniqueVertices[vertex] = C_UI32T(vertices.size());
-                    vertices.emplace_back(std::move(vertex));
-                }
-                indices.emplace_back(uniqueVertices[vertex]);
+        // a single shape is deduplicated in place, several are concatenated so chunks can span shape boundaries
+        std::vector<tinyobj::index_t> mergedIndices{};
+        std::span<const tinyobj::index_t> corners{};
+        if(shapes.size() == 1) [[likely]] {
+            corners = shapes.front().mesh.indices;
+        } else {
+            std::size_t cornerCount = 0;
+            for(const auto &shape : shapes) { cornerCount += shape.mesh.indices.size(); }
+            mergedIndices.reserve(cornerCount);
+            for(const auto &shape : shapes) {
+                mergedIndices.insert(mergedIndices.end(), shape.mesh.indices.begin(), shape.mesh.indices.end());
             }
-        });
+            corners = mergedIndices;
+        }
+
+        const auto fetchVertex = [&attrib, corners](const std::size_t corner) noexcept {
+            const auto &index = corners[corner];
+            Vertex vertex{};
+            const auto vertex_index = 3 * index.vertex_index;
+
+            if(index.vertex_index >= 0) [[likely]] {
+                vertex.position = {attrib.vertices[vertex_index], attrib.vertices[vertex_index + 1], attrib.vertices[vertex_index + 2]};
+
+                vertex.color = {attrib.colors[vertex_index], attrib.colors[vertex_index + 1], attrib.colors[vertex_index + 2]};
+            }
+
+            if(index.normal_index >= 0) [[likely]] {
+                const auto normal_index = 3 * index.normal_index;
+                vertex.normal = {attrib.normals[normal_index], attrib.normals[normal_index + 1], attrib.normals[normal_index + 2]};
+            }
+
+            if(index.texcoord_index >= 0) [[likely]] {
+                const auto texcoord_index = 2 * index.texcoord_index;
+                vertex.uv = {attrib.texcoords[texcoord_index], attrib.texcoords[texcoord_index + 1]};
+            }
+            return vertex;
+        };
+
+        deduplicateVertices(corners.size(), fetchVertex, vertices, indices);
     }
 
     DISABLE_WARNINGS_POP()
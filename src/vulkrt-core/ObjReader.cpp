@@ -0,0 +1,279 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner *-pro-bounds-pointer-arithmetic)
+#include "vulkrt/ObjReader.hpp"
+#include "vulkrt/MappedFile.hpp"
+#include "vulkrt/VertexDedup.hpp"
+
+#include <charconv>
+#include <numeric>
+#include <thread>
+#include <vulkrt/timer/Timer.hpp>
+
+namespace lve {
+    namespace {
+        constexpr int32_t NO_INDEX = std::numeric_limits<int32_t>::min();
+        constexpr uint8_t RELATIVE_V = 1U;
+        constexpr uint8_t RELATIVE_VT = 2U;
+        constexpr uint8_t RELATIVE_VN = 4U;
+        constexpr glm::vec3 DEFAULT_COLOR{1.f, 1.f, 1.f};
+
+        /**
+         * Face corner as parsed. Positive OBJ indices are stored 0-based and absolute; negative (relative) ones are
+         * stored relative to the first element of the chunk and flagged, they become absolute once the chunk offsets
+         * are known.
+         */
+        struct Corner {
+            int32_t v = NO_INDEX;
+            int32_t vt = NO_INDEX;
+            int32_t vn = NO_INDEX;
+            uint8_t relative = 0;
+        };
+
+        struct Chunk {
+            const char *begin = nullptr;
+            const char *end = nullptr;
+            std::vector<glm::vec3> positions{};
+            std::vector<glm::vec3> colors{};
+            std::vector<glm::vec3> normals{};
+            std::vector<glm::vec2> uvs{};
+            std::vector<Corner> corners{};
+            std::string error{};
+            const char *errorAt = nullptr;
+        };
+
+        [[nodiscard]] constexpr bool isBlank(const char chr) noexcept { return chr == ' ' || chr == '\t' || chr == '\r'; }
+
+        constexpr void skipBlanks(const char *&cur, const char *end) noexcept {
+            while(cur < end && isBlank(*cur)) { ++cur; }
+        }
+
+        [[nodiscard]] bool parseFloat(const char *&cur, const char *end, float &value) noexcept {
+            skipBlanks(cur, end);
+            if(cur < end && *cur == '+') { ++cur; }
+            const auto [ptr, ec] = std::from_chars(cur, end, value);
+            if(ec != std::errc{}) { return false; }
+            cur = ptr;
+            return true;
+        }
+
+        [[nodiscard]] bool parseInt(const char *&cur, const char *end, int32_t &value) noexcept {
+            if(cur < end && *cur == '+') { ++cur; }
+            const auto [ptr, ec] = std::from_chars(cur, end, value);
+            if(ec != std::errc{}) { return false; }
+            cur = ptr;
+            return true;
+        }
+
+        /// converts a raw OBJ index (1-based, or negative from the end) into the Corner encoding
+        [[nodiscard]] bool encodeIndex(const int32_t raw, const std::size_t localCount, int32_t &out, uint8_t &relative,
+                                       const uint8_t flag) noexcept {
+            if(raw > 0) {
+                out = raw - 1;
+                return true;
+            }
+            if(raw < 0) {
+                out = C_I32T(localCount) + raw;
+                relative |= flag;
+                return true;
+            }
+            return false;
+        }
+
+        [[nodiscard]] bool parseCorner(const char *&cur, const char *end, const Chunk &chunk, Corner &corner) noexcept {
+            int32_t raw = 0;
+            if(!parseInt(cur, end, raw) || !encodeIndex(raw, chunk.positions.size(), corner.v, corner.relative, RELATIVE_V)) {
+                return false;
+            }
+            if(cur >= end || *cur != '/') { return true; }
+            ++cur;
+            if(cur < end && *cur != '/') {
+                if(!parseInt(cur, end, raw) || !encodeIndex(raw, chunk.uvs.size(), corner.vt, corner.relative, RELATIVE_VT)) {
+                    return false;
+                }
+            }
+            if(cur >= end || *cur != '/') { return true; }
+            ++cur;
+            return parseInt(cur, end, raw) && encodeIndex(raw, chunk.normals.size(), corner.vn, corner.relative, RELATIVE_VN);
+        }
+
+        [[nodiscard]] bool parseVec3(const char *&cur, const char *end, glm::vec3 &value) noexcept {
+            return parseFloat(cur, end, value.x) && parseFloat(cur, end, value.y) && parseFloat(cur, end, value.z);
+        }
+
+        void parseChunk(Chunk &chunk) {
+            std::vector<Corner> polygon{};
+            const char *cur = chunk.begin;
+            const char *const end = chunk.end;
+            while(cur < end) {
+                const char *lineEnd = static_cast<const char *>(std::memchr(cur, '\n', C_ST(end - cur)));
+                if(lineEnd == nullptr) { lineEnd = end; }
+                const char *const lineStart = cur;
+                skipBlanks(cur, lineEnd);
+
+                bool ok = true;
+                if(lineEnd - cur >= 2 && cur[0] == 'v' && isBlank(cur[1])) {
+                    cur += 2;
+                    glm::vec3 position{};
+                    ok = parseVec3(cur, lineEnd, position);
+                    glm::vec3 color{DEFAULT_COLOR};
+                    // xyz, xyzw or xyzrgb: only a full rgb triplet is a color
+                    if(ok && !parseVec3(cur, lineEnd, color)) { color = DEFAULT_COLOR; }
+                    chunk.positions.emplace_back(position);
+                    chunk.colors.emplace_back(color);
+                } else if(lineEnd - cur >= 3 && cur[0] == 'v' && cur[1] == 'n' && isBlank(cur[2])) {
+                    cur += 3;
+                    glm::vec3 normal{};
+                    ok = parseVec3(cur, lineEnd, normal);
+                    chunk.normals.emplace_back(normal);
+                } else if(lineEnd - cur >= 3 && cur[0] == 'v' && cur[1] == 't' && isBlank(cur[2])) {
+                    cur += 3;
+                    glm::vec2 uv{};
+                    ok = parseFloat(cur, lineEnd, uv.x);
+                    if(ok && !parseFloat(cur, lineEnd, uv.y)) { uv.y = 0.f; }
+                    chunk.uvs.emplace_back(uv);
+                } else if(lineEnd - cur >= 2 && cur[0] == 'f' && isBlank(cur[1])) {
+                    cur += 2;
+                    polygon.clear();
+                    skipBlanks(cur, lineEnd);
+                    while(ok && cur < lineEnd) {
+                        Corner corner{};
+                        ok = parseCorner(cur, lineEnd, chunk, corner);
+                        polygon.emplace_back(corner);
+                        skipBlanks(cur, lineEnd);
+                    }
+                    ok = ok && polygon.size() >= 3;
+                    for(std::size_t i = 1; ok && i + 1 < polygon.size(); ++i) {
+                        chunk.corners.emplace_back(polygon[0]);
+                        chunk.corners.emplace_back(polygon[i]);
+                        chunk.corners.emplace_back(polygon[i + 1]);
+                    }
+                }
+
+                if(!ok) [[unlikely]] {
+                    chunk.error = FORMAT("malformed statement '{}'", std::string_view{lineStart, C_ST(lineEnd - lineStart)});
+                    chunk.errorAt = lineStart;
+                    return;
+                }
+                cur = lineEnd + 1;
+            }
+        }
+
+        [[nodiscard]] std::vector<Chunk> splitChunks(std::span<const std::byte> bytes, const ObjReader::Options &options) {
+            const auto *const begin = std::bit_cast<const char *>(bytes.data());
+            const auto *const end = begin + bytes.size();
+            std::size_t chunkCount = 1;
+            if(options.parallel && options.minChunkBytes > 0) {
+                const std::size_t workers = std::max(1U, std::thread::hardware_concurrency());
+                chunkCount = std::clamp(bytes.size() / options.minChunkBytes, std::size_t{1}, workers);
+            }
+
+            std::vector<Chunk> chunks(chunkCount);
+            const char *chunkBegin = begin;
+            for(std::size_t i = 0; i < chunkCount; ++i) {
+                const char *chunkEnd = end;
+                if(i + 1 < chunkCount) {
+                    chunkEnd = std::max(chunkBegin, begin + (bytes.size() * (i + 1)) / chunkCount);
+                    // cut right after a newline so no statement straddles two chunks
+                    const void *newline = std::memchr(chunkEnd, '\n', C_ST(end - chunkEnd));
+                    chunkEnd = newline == nullptr ? end : static_cast<const char *>(newline) + 1;
+                }
+                chunks[i].begin = chunkBegin;
+                chunks[i].end = chunkEnd;
+                chunkBegin = chunkEnd;
+            }
+            return chunks;
+        }
+
+        /// one array of every chunk seen as a single array in file order, without copying the chunks together
+        template <typename T> class ChunkedArray {
+        public:
+            ChunkedArray(const std::vector<Chunk> &chunks, std::vector<T> Chunk::*member) {
+                starts.reserve(chunks.size());
+                parts.reserve(chunks.size());
+                for(const auto &chunk : chunks) {
+                    starts.emplace_back(count);
+                    parts.emplace_back((chunk.*member).data());
+                    count += (chunk.*member).size();
+                }
+            }
+
+            [[nodiscard]] std::size_t size() const noexcept { return count; }
+            /// index of the first element of chunk part
+            [[nodiscard]] std::size_t start(const std::size_t part) const noexcept { return starts[part]; }
+            /// index must be below size(); there are at most as many chunks as hardware threads, so the search is short
+            [[nodiscard]] const T &operator[](const std::size_t index) const noexcept {
+                const auto part = C_ST(std::ranges::upper_bound(starts, index) - starts.begin()) - 1;
+                return parts[part][index - starts[part]];
+            }
+
+        private:
+            std::vector<std::size_t> starts{};
+            std::vector<const T *> parts{};
+            std::size_t count = 0;
+        };
+    }  // namespace
+
+    DISABLE_WARNINGS_PUSH(26446 26481 26482)
+    void ObjReader::read(const fs::path &filepath, std::vector<Model::Vertex> &vertices, std::vector<uint32_t> &indices,
+                         const Options &options) {
+#ifdef INDEPTH
+        const vnd::AutoTimer t{FORMAT("ObjReader::read {}", filepath.string()), vnd::Timer::Big};
+#endif
+        const MappedFile file{filepath};
+        auto chunks = splitChunks(file.bytes(), options);
+
+        std::for_each(std::execution::par, chunks.begin(), chunks.end(), [](Chunk &chunk) { parseChunk(chunk); });
+        for(const auto &chunk : chunks) {
+            if(!chunk.error.empty()) [[unlikely]] {
+                throw std::runtime_error(FORMAT("{}: {} at byte {}", filepath.string(), chunk.error,
+                                                chunk.errorAt - std::bit_cast<const char *>(file.data())));
+            }
+        }
+
+        // attributes and corners stay in their chunks, relative indices are resolved against the chunk offsets in place
+        const ChunkedArray positions{chunks, &Chunk::positions};
+        const ChunkedArray colors{chunks, &Chunk::colors};
+        const ChunkedArray normals{chunks, &Chunk::normals};
+        const ChunkedArray uvs{chunks, &Chunk::uvs};
+        std::atomic_bool outOfRange{false};
+        std::vector<std::size_t> chunkIds(chunks.size());
+        std::iota(chunkIds.begin(), chunkIds.end(), std::size_t{0});
+        std::for_each(std::execution::par, chunkIds.begin(), chunkIds.end(), [&](const std::size_t id) {
+            const auto resolve = [&outOfRange](int32_t &index, const bool relative, const std::size_t offset, const std::size_t count) {
+                if(index == NO_INDEX) { return; }
+                const auto absolute = C_I64T(index) + (relative ? C_I64T(offset) : 0);
+                if(absolute < 0 || absolute >= C_I64T(count)) [[unlikely]] {
+                    outOfRange.store(true, std::memory_order_relaxed);
+                    index = NO_INDEX;
+                    return;
+                }
+                index = C_I32T(absolute);
+            };
+            for(Corner &corner : chunks[id].corners) {
+                resolve(corner.v, (corner.relative & RELATIVE_V) != 0, positions.start(id), positions.size());
+                resolve(corner.vt, (corner.relative & RELATIVE_VT) != 0, uvs.start(id), uvs.size());
+                resolve(corner.vn, (corner.relative & RELATIVE_VN) != 0, normals.start(id), normals.size());
+            }
+        });
+        if(outOfRange.load()) [[unlikely]] { throw std::runtime_error(FORMAT("{}: face index out of range", filepath.string())); }
+
+        const ChunkedArray corners{chunks, &Chunk::corners};
+        const auto fetchVertex = [&](const std::size_t cornerIndex) noexcept {
+            const Corner &corner = corners[cornerIndex];
+            Model::Vertex vertex{};
+            if(corner.v != NO_INDEX) [[likely]] {
+                vertex.position = positions[C_ST(corner.v)];
+                vertex.color = colors[C_ST(corner.v)];
+            }
+            if(corner.vn != NO_INDEX) [[likely]] { vertex.normal = normals[C_ST(corner.vn)]; }
+            if(corner.vt != NO_INDEX) [[likely]] { vertex.uv = uvs[C_ST(corner.vt)]; }
+            return vertex;
+        };
+        deduplicateVertices(corners.size(), fetchVertex, vertices, indices);
+    }
+    DISABLE_WARNINGS_POP()
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner *-pro-bounds-pointer-arithmetic)
@@ -0,0 +1,142 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner *-signed-bitwise)
+#include "vulkrt/OffscreenTarget.hpp"
+
+namespace lve {
+    DISABLE_WARNINGS_PUSH(26446 26482)
+    OffscreenTarget::OffscreenTarget(Device &deviceRef, const VkExtent2D &targetExtent, uint32_t framesInFlight)
+      : device{deviceRef}, extent{targetExtent},
+        depthFormat{device.findSupportedFormat({VK_FORMAT_D32_SFLOAT, VK_FORMAT_D32_SFLOAT_S8_UINT, VK_FORMAT_D24_UNORM_S8_UINT},
+                                               VK_IMAGE_TILING_OPTIMAL, VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT)},
+        frames(framesInFlight) {
+        createRenderPass();
+        std::ranges::for_each(frames, [this](Frame &frame) { createFrame(frame); });
+        LINFO("offscreen target: {}x{}, {} image sets", extent.width, extent.height, frames.size());
+    }
+
+    OffscreenTarget::~OffscreenTarget() {
+        const auto device_device = device.device();
+        for(Frame &frame : frames) {
+            vkDestroyFence(device_device, frame.inFlight, nullptr);
+            vkDestroyFramebuffer(device_device, frame.framebuffer, nullptr);
+            vkDestroyImageView(device_device, frame.depthView, nullptr);
+            vkDestroyImageView(device_device, frame.colorView, nullptr);
+            if(frame.depth != VK_NULL_HANDLE) { device.destroyImage(frame.depth, frame.depthAllocation); }
+            if(frame.color != VK_NULL_HANDLE) { device.destroyImage(frame.color, frame.colorAllocation); }
+        }
+        vkDestroyRenderPass(device_device, renderPass, nullptr);
+    }
+
+    void OffscreenTarget::createRenderPass() {
+        const std::array<VkAttachmentDescription, 2> attachments{{
+            {.format = COLOR_FORMAT,
+             .samples = VK_SAMPLE_COUNT_1_BIT,
+             .loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR,
+             .storeOp = VK_ATTACHMENT_STORE_OP_STORE,
+             .stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+             .stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
+             .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+             .finalLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL},
+            {.format = depthFormat,
+             .samples = VK_SAMPLE_COUNT_1_BIT,
+             .loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR,
+             .storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
+             .stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+             .stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
+             .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+             .finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL},
+        }};
+        const VkAttachmentReference colorAttachmentRef{.attachment = 0, .layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+        const VkAttachmentReference depthAttachmentRef{.attachment = 1, .layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL};
+        const VkSubpassDescription subpass{.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                           .colorAttachmentCount = 1,
+                                           .pColorAttachments = &colorAttachmentRef,
+                                           .pDepthStencilAttachment = &depthAttachmentRef};
+        // same external dependency as the swap chain pass, so pipelines built for either behave the same
+        const VkSubpassDependency dependency{
+            .srcSubpass = VK_SUBPASS_EXTERNAL,
+            .dstSubpass = 0,
+            .srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT,
+            .dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT,
+            .srcAccessMask = 0,
+            .dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,
+        };
+        const VkRenderPassCreateInfo renderPassInfo{.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO,
+                                                    .attachmentCount = C_UI32T(attachments.size()),
+                                                    .pAttachments = attachments.data(),
+                                                    .subpassCount = 1,
+                                                    .pSubpasses = &subpass,
+                                                    .dependencyCount = 1,
+                                                    .pDependencies = &dependency};
+        VK_CHECK(vkCreateRenderPass(device.device(), &renderPassInfo, nullptr, &renderPass), "failed to create offscreen render pass!");
+    }
+
+    void OffscreenTarget::createFrame(Frame &frame) {
+        VkImageCreateInfo imageInfo{.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+                                    .imageType = VK_IMAGE_TYPE_2D,
+                                    .format = COLOR_FORMAT,
+                                    .extent = {extent.width, extent.height, 1},
+                                    .mipLevels = 1,
+                                    .arrayLayers = 1,
+                                    .samples = VK_SAMPLE_COUNT_1_BIT,
+                                    .tiling = VK_IMAGE_TILING_OPTIMAL,
+                                    .usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT,
+                                    .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+                                    .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED};
+        device.createImageWithInfo(imageInfo, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, frame.color, frame.colorAllocation);
+        frame.colorView = createView(frame.color, COLOR_FORMAT, VK_IMAGE_ASPECT_COLOR_BIT);
+
+        imageInfo.format = depthFormat;
+        imageInfo.usage = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+        device.createImageWithInfo(imageInfo, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, frame.depth, frame.depthAllocation);
+        frame.depthView = createView(frame.depth, depthFormat, VK_IMAGE_ASPECT_DEPTH_BIT);
+
+        const std::array<VkImageView, 2> attachments{frame.colorView, frame.depthView};
+        const VkFramebufferCreateInfo framebufferInfo{.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO,
+                                                      .renderPass = renderPass,
+                                                      .attachmentCount = C_UI32T(attachments.size()),
+                                                      .pAttachments = attachments.data(),
+                                                      .width = extent.width,
+                                                      .height = extent.height,
+                                                      .layers = 1};
+        VK_CHECK(vkCreateFramebuffer(device.device(), &framebufferInfo, nullptr, &frame.framebuffer), "failed to create framebuffer!");
+
+        const VkFenceCreateInfo fenceInfo{.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO, .flags = VK_FENCE_CREATE_SIGNALED_BIT};
+        VK_CHECK(vkCreateFence(device.device(), &fenceInfo, nullptr, &frame.inFlight), "failed to create offscreen frame fence!");
+    }
+
+    VkImageView OffscreenTarget::createView(VkImage image, VkFormat format, VkImageAspectFlags aspect) const {
+        const VkImageViewCreateInfo viewInfo{.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+                                             .image = image,
+                                             .viewType = VK_IMAGE_VIEW_TYPE_2D,
+                                             .format = format,
+                                             .subresourceRange = {.aspectMask = aspect,
+                                                                  .baseMipLevel = 0,
+                                                                  .levelCount = 1,
+                                                                  .baseArrayLayer = 0,
+                                                                  .layerCount = 1}};
+        VkImageView view = VK_NULL_HANDLE;
+        VK_CHECK(vkCreateImageView(device.device(), &viewInfo, nullptr, &view), "failed to create offscreen image view!");
+        return view;
+    }
+
+    VkResult OffscreenTarget::acquireNextImage(uint32_t *imageIndex) const noexcept {
+        *imageIndex = C_UI32T(currentFrame);
+        return vkWaitForFences(device.device(), 1, &frames[currentFrame].inFlight, VK_TRUE, MAXU64);
+    }
+
+    VkResult OffscreenTarget::submitCommandBuffers(const VkCommandBuffer *buffers, const uint32_t *imageIndex) {
+        assert(*imageIndex == currentFrame && "submit the image returned by the last acquireNextImage");
+        const VkFence fence = frames[*imageIndex].inFlight;
+        const VkSubmitInfo submitInfo{.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO, .commandBufferCount = 1, .pCommandBuffers = buffers};
+        vkResetFences(device.device(), 1, &fence);
+        const VkResult result = vkQueueSubmit(device.graphicsQueue(), 1, &submitInfo, fence);
+        currentFrame = (currentFrame + 1) % frames.size();
+        return result;
+    }
+    DISABLE_WARNINGS_POP()
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner *-signed-bitwise)
@@ -0,0 +1,113 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/ParallelRecorder.hpp"
+#include "vulkrt/SwapChain.hpp"
+
+#include <latch>
+#include <vulkrt/timer/Timer.hpp>
+
+namespace lve {
+    DISABLE_WARNINGS_PUSH(26446 26482)
+    ParallelRecorder::ParallelRecorder(Device &device, uint32_t framesInFlight, std::size_t threadCount)
+      : lveDevice{device}, threads{threadCount == 0 ? std::max(1U, std::thread::hardware_concurrency()) : threadCount} {
+        const uint32_t graphicsFamily = lveDevice.findPhysicalQueueFamilies().graphicsFamily;
+        frames.resize(framesInFlight);
+        for(auto &slots : frames) {
+            slots.resize(threads);
+            for(auto &slot : slots) {
+                // reset as a whole once per frame, so no per buffer reset flag
+                const VkCommandPoolCreateInfo poolInfo{.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+                                                       .flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
+                                                       .queueFamilyIndex = graphicsFamily};
+                VK_CHECK(vkCreateCommandPool(lveDevice.device(), &poolInfo, nullptr, &slot.pool),
+                         "failed to create recording command pool!");
+                const VkCommandBufferAllocateInfo allocInfo{.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+                                                            .commandPool = slot.pool,
+                                                            .level = VK_COMMAND_BUFFER_LEVEL_SECONDARY,
+                                                            .commandBufferCount = 1};
+                VK_CHECK(vkAllocateCommandBuffers(lveDevice.device(), &allocInfo, &slot.commandBuffer),
+                         "failed to allocate secondary command buffer!");
+            }
+        }
+        if(threads > 1) { workers = MAKE_UNIQUE(ThreadPool, threads - 1); }
+        LINFO("parallel recorder: {} threads", threads);
+    }
+
+    ParallelRecorder::~ParallelRecorder() {
+        workers.reset();
+        for(const auto &slots : frames) {
+            for(const auto &slot : slots) { vkDestroyCommandPool(lveDevice.device(), slot.pool, nullptr); }
+        }
+    }
+
+    void ParallelRecorder::recordSlot(const Slot &slot, const VkCommandBufferInheritanceInfo &inheritance, const PassInfo &pass,
+                                      std::size_t begin, std::size_t end, const RecordFn &recordChunk) const {
+        TRACE_SCOPE("record secondary");
+        const VkCommandBufferBeginInfo beginInfo{.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+                                                 // NOLINTNEXTLINE(*-signed-bitwise)
+                                                 .flags = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT |
+                                                          VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+                                                 .pInheritanceInfo = &inheritance};
+        VK_CHECK(vkBeginCommandBuffer(slot.commandBuffer, &beginInfo), "failed to begin secondary command buffer!");
+        // dynamic state is not inherited from the primary
+        const VkViewport viewport{.x = 0.0f,
+                                  .y = 0.0f,
+                                  .width = C_F(pass.extent.width),
+                                  .height = C_F(pass.extent.height),
+                                  .minDepth = 0.0f,
+                                  .maxDepth = 1.0f};
+        const VkRect2D scissor{{0, 0}, pass.extent};
+        vkCmdSetViewport(slot.commandBuffer, 0, 1, &viewport);
+        vkCmdSetScissor(slot.commandBuffer, 0, 1, &scissor);
+        recordChunk(slot.commandBuffer, begin, end);
+        VK_CHECK(vkEndCommandBuffer(slot.commandBuffer), "failed to record secondary command buffer!");
+    }
+
+    void ParallelRecorder::record(VkCommandBuffer primary, int frameIndex, const PassInfo &pass, std::size_t count,
+                                  const RecordFn &recordChunk, std::size_t minChunk) {
+#ifdef INDEPTH
+        const vnd::AutoTimer t{"ParallelRecorder::record", vnd::Timer::Big};
+#endif
+        if(count == 0) { return; }
+        const auto &slots = frames[C_ST(frameIndex)];
+        const std::size_t chunks = std::clamp<std::size_t>(count / std::max<std::size_t>(minChunk, 1), 1, threads);
+        // floor bounds give every chunk count / chunks or one more items, so none is empty and none starts past count
+        const auto chunkBegin = [count, chunks](std::size_t chunk) { return chunk * count / chunks; };
+        const VkCommandBufferInheritanceInfo inheritance{.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+                                                         .renderPass = pass.renderPass,
+                                                         .subpass = 0,
+                                                         .framebuffer = pass.framebuffer};
+
+        // the slots of frameIndex were last submitted one frames-in-flight cycle ago and beginFrame waited for them
+        for(std::size_t chunk = 0; chunk < chunks; ++chunk) {
+            VK_CHECK(vkResetCommandPool(lveDevice.device(), slots[chunk].pool, 0), "failed to reset recording command pool!");
+        }
+
+        std::vector<std::exception_ptr> errors(chunks);
+        std::latch done{C_I64T(chunks - 1)};
+        for(std::size_t chunk = 1; chunk < chunks; ++chunk) {
+            workers->submit([&, chunk] {
+                try {
+                    recordSlot(slots[chunk], inheritance, pass, chunkBegin(chunk), chunkBegin(chunk + 1), recordChunk);
+                } catch(...) { errors[chunk] = std::current_exception(); }
+                done.count_down();
+            });
+        }
+        try {
+            recordSlot(slots[0], inheritance, pass, 0, chunkBegin(1), recordChunk);
+        } catch(...) { errors[0] = std::current_exception(); }
+        done.wait();
+        for(const auto &error : errors) {
+            if(error) [[unlikely]] { std::rethrow_exception(error); }
+        }
+
+        executed.clear();
+        for(std::size_t chunk = 0; chunk < chunks; ++chunk) { executed.emplace_back(slots[chunk].commandBuffer); }
+        vkCmdExecuteCommands(primary, C_UI32T(executed.size()), executed.data());
+    }
+    DISABLE_WARNINGS_POP()
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
@@ -88,8 +88,8 @@ namespace lve {
                                             .pName = vertFragPName,
                                             .pSpecializationInfo = nullptr}};
 
-        const auto bindingDescriptions = Model::Vertex::getBindingDescriptions();
-        const auto attributeDescriptions = Model::Vertex::getAttributeDescriptions();
+        const auto &bindingDescriptions = configInfo.bindingDescriptions;
+        const auto &attributeDescriptions = configInfo.attributeDescriptions;
         VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
         vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
         vertexInputInfo.vertexAttributeDescriptionCount = C_UI32T(attributeDescriptions.size());
@@ -116,17 +116,11 @@ namespace lve {
             .basePipelineIndex = -1,
         };
 
-        // Enable pipeline cache
-        VkPipelineCache pipelineCache = VK_NULL_HANDLE;
-        VkPipelineCacheCreateInfo pipelineCacheInfo{};
-        pipelineCacheInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
-        vkCreatePipelineCache(device_device, &pipelineCacheInfo, nullptr, &pipelineCache);
-
-        VK_CHECK(vkCreateGraphicsPipelines(device_device, pipelineCache, 1, &pipelineInfo, nullptr, &graphicsPipeline),
+        // the device cache outlives this pipeline and is saved on shutdown, so later runs and rebuilds skip compilation
+        const vnd::Timer creationTimer{"vkCreateGraphicsPipelines"};
+        VK_CHECK(vkCreateGraphicsPipelines(device_device, lveDevice.pipelineCache(), 1, &pipelineInfo, nullptr, &graphicsPipeline),
                  "failed to create graphics pipeline");
-
-        // Destroy pipeline cache after creation
-        vkDestroyPipelineCache(device_device, pipelineCache, nullptr);
+        lveDevice.addPipelineCreationTime(creationTimer.make_time());
     }
     DISABLE_WARNINGS_POP()
 
@@ -214,6 +208,9 @@ namespace lve {
         configInfo.dynamicStateInfo.pDynamicStates = configInfo.dynamicStateEnables.data();
         configInfo.dynamicStateInfo.dynamicStateCount = C_UI32T(configInfo.dynamicStateEnables.size());
         configInfo.dynamicStateInfo.flags = 0;
+
+        configInfo.bindingDescriptions = Model::Vertex::getBindingDescriptions();
+        configInfo.attributeDescriptions = Model::Vertex::getAttributeDescriptions();
     }
 
 }  // namespace lve
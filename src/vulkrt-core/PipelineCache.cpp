@@ -0,0 +1,100 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/PipelineCache.hpp"
+
+#include <vulkrt/timer/Timer.hpp>
+
+namespace lve {
+
+    DISABLE_WARNINGS_PUSH(26446 26481 26482)
+    PipelineCache::PipelineCache(VkDevice device, const VkPhysicalDeviceProperties &properties, fs::path path)
+      : device{device}, properties{properties}, path{std::move(path)} {
+        const std::vector<char> initialData = loadValidated();
+        const VkPipelineCacheCreateInfo createInfo{.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+                                                   .initialDataSize = initialData.size(),
+                                                   .pInitialData = initialData.empty() ? nullptr : initialData.data()};
+        VK_CHECK(vkCreatePipelineCache(device, &createInfo, nullptr, &cache), "failed to create pipeline cache!");
+        warm = !initialData.empty();
+        if(!warm) {
+            LINFO("pipeline cache: starting cold");
+        } else {
+            LINFO("pipeline cache: loaded {} bytes from {}", initialData.size(), this->path.string());
+        }
+    }
+
+    PipelineCache::~PipelineCache() {
+        save();
+        vkDestroyPipelineCache(device, cache, nullptr);
+    }
+
+    std::vector<char> PipelineCache::loadValidated() const {
+        try {
+            if(!fs::exists(path)) { return {}; }
+#ifdef INDEPTH
+            const vnd::AutoTimer t{FORMAT("PipelineCache::load {}", path.string()), vnd::Timer::Big};
+#endif
+            std::ifstream in{path, std::ios::binary | std::ios::ate};  // NOLINT(*-signed-bitwise)
+            if(!in.is_open()) [[unlikely]] { return {}; }
+            std::vector<char> data(C_ST(in.tellg()));
+            in.seekg(0);
+            in.read(data.data(), C_LL(data.size()));
+            if(!in) [[unlikely]] { return {}; }
+
+            // VkPipelineCacheHeaderVersionOne, the layout every driver writes first
+            struct Header {
+                uint32_t headerSize;
+                uint32_t headerVersion;
+                uint32_t vendorID;
+                uint32_t deviceID;
+                std::array<uint8_t, VK_UUID_SIZE> pipelineCacheUUID;
+            };
+            static_assert(sizeof(Header) == 32);
+            Header header{};
+            if(data.size() < sizeof(Header)) {
+                LWARN("pipeline cache {} is truncated, ignoring it", path.string());
+                return {};
+            }
+            std::memcpy(&header, data.data(), sizeof(Header));
+            const bool matches = header.headerSize >= sizeof(Header) && header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+                                 header.vendorID == properties.vendorID && header.deviceID == properties.deviceID &&
+                                 std::memcmp(header.pipelineCacheUUID.data(), properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+            if(!matches) {
+                LWARN("pipeline cache {} was written by another device or driver, ignoring it", path.string());
+                return {};
+            }
+            return data;
+        } catch(const std::exception &e) {
+            LWARN("failed to read pipeline cache {}: {}", path.string(), e.what());
+            return {};
+        }
+    }
+
+    void PipelineCache::save() const noexcept {
+        // compare a cold and a warm launch with this line
+        LINFO("pipeline cache: {} pipelines created in {:.3f} ms from a {} cache", creationCount, C_D(creationTime) * 1e-6,
+              warm ? "warm" : "cold");
+        try {
+            std::size_t size = 0;
+            VK_CHECK(vkGetPipelineCacheData(device, cache, &size, nullptr), "failed to query pipeline cache size!");
+            std::vector<char> data(size);
+            VK_CHECK(vkGetPipelineCacheData(device, cache, &size, data.data()), "failed to read pipeline cache!");
+            data.resize(size);
+
+            fs::path tmpPath = path;
+            tmpPath += ".tmp";
+            {
+                std::ofstream out{tmpPath, std::ios::binary | std::ios::trunc};  // NOLINT(*-signed-bitwise)
+                if(!out.is_open()) [[unlikely]] { throw std::runtime_error(FORMAT("failed to open {}", tmpPath.string())); }
+                out.write(data.data(), C_LL(data.size()));
+                if(!out) [[unlikely]] { throw std::runtime_error(FORMAT("failed to write {}", tmpPath.string())); }
+            }
+            fs::rename(tmpPath, path);
+            LINFO("pipeline cache: saved {} bytes to {}", data.size(), path.string());
+        } catch(const std::exception &e) { LWARN("failed to save pipeline cache {}: {}", path.string(), e.what()); }
+    }
+    DISABLE_WARNINGS_POP()
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
@@ -0,0 +1,67 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/PipelineStatistics.hpp"
+
+namespace lve {
+    // NOLINTBEGIN(*-signed-bitwise)
+    static inline constexpr VkQueryPipelineStatisticFlags STATISTICS =
+        VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_VERTICES_BIT | VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_PRIMITIVES_BIT |
+        VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT | VK_QUERY_PIPELINE_STATISTIC_CLIPPING_INVOCATIONS_BIT |
+        VK_QUERY_PIPELINE_STATISTIC_CLIPPING_PRIMITIVES_BIT | VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT;
+    // NOLINTEND(*-signed-bitwise)
+    static inline constexpr std::size_t STATISTIC_COUNT = sizeof(PipelineStatistics::Values) / sizeof(uint64_t);
+
+    PipelineStatistics::PipelineStatistics(Device &device, uint32_t framesInFlight)
+      : lveDevice{device}, slots(framesInFlight, SlotState::Idle) {
+        if(lveDevice.features().pipelineStatisticsQuery == VK_FALSE) [[unlikely]] {
+            LWARN("pipeline statistics: pipelineStatisticsQuery is not supported, only draw counters are reported");
+            return;
+        }
+        const VkQueryPoolCreateInfo poolInfo{
+            .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+            .queryType = VK_QUERY_TYPE_PIPELINE_STATISTICS,
+            .queryCount = framesInFlight,
+            .pipelineStatistics = STATISTICS,
+        };
+        VK_CHECK(vkCreateQueryPool(lveDevice.device(), &poolInfo, nullptr, &queryPool), "failed to create pipeline statistics query pool!");
+    }
+
+    PipelineStatistics::~PipelineStatistics() {
+        if(queryPool != VK_NULL_HANDLE) { vkDestroyQueryPool(lveDevice.device(), queryPool, nullptr); }
+    }
+
+    DISABLE_WARNINGS_PUSH(26446)
+    void PipelineStatistics::reset(VkCommandBuffer commandBuffer, uint32_t frameIndex) {
+        if(!isEnabled()) { return; }
+        if(slots[frameIndex] == SlotState::Pending) {
+            // the statistics followed by the availability word
+            std::array<uint64_t, STATISTIC_COUNT + 1> results{};
+            const VkQueryResultFlags flags = VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT;  // NOLINT(*-signed-bitwise)
+            const VkResult result = vkGetQueryPoolResults(lveDevice.device(), queryPool, frameIndex, 1, sizeof(results), results.data(),
+                                                          sizeof(results), flags);
+            if(result == VK_SUCCESS && results[STATISTIC_COUNT] != 0) [[likely]] {
+                std::memcpy(&lastValues, results.data(), sizeof(lastValues));
+                ++frameCount;
+            }
+        }
+        vkCmdResetQueryPool(commandBuffer, queryPool, frameIndex, 1);
+        slots[frameIndex] = SlotState::Reset;
+    }
+
+    void PipelineStatistics::begin(VkCommandBuffer commandBuffer, uint32_t frameIndex) noexcept {
+        if(!isEnabled() || slots[frameIndex] != SlotState::Reset) { return; }
+        vkCmdBeginQuery(commandBuffer, queryPool, frameIndex, 0);
+        slots[frameIndex] = SlotState::Active;
+    }
+
+    void PipelineStatistics::end(VkCommandBuffer commandBuffer, uint32_t frameIndex) noexcept {
+        if(!isEnabled() || slots[frameIndex] != SlotState::Active) { return; }
+        vkCmdEndQuery(commandBuffer, queryPool, frameIndex);
+        slots[frameIndex] = SlotState::Pending;
+    }
+    DISABLE_WARNINGS_POP()
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
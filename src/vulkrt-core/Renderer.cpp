@@ -4,29 +4,55 @@
 // NOLINTBEGIN(*-include-cleaner)
 
 #include "vulkrt/Renderer.hpp"
+#include "vulkrt/MeshPool.hpp"
+#include "vulkrt/StagingRing.hpp"
+#include "vulkrt/timer/TraceProfiler.hpp"
 namespace lve {
+    static std::size_t checkFramesInFlight(uint32_t framesInFlight) {
+        if(framesInFlight < 1 || framesInFlight > SwapChain::MAX_FRAMES_IN_FLIGHT) [[unlikely]] {
+            throw std::runtime_error(
+                FORMAT("frames in flight must be in [1, {}], got {}", SwapChain::MAX_FRAMES_IN_FLIGHT, framesInFlight));
+        }
+        LINFO("renderer: {} frames in flight", framesInFlight);
+        return framesInFlight;
+    }
+
     DISABLE_WARNINGS_PUSH(26432 26447)
-    Renderer::Renderer(Window &window, Device &device) noexcept : lveWindow{window}, lveDevice{device} {
+    Renderer::Renderer(Window &window, Device &device, uint32_t framesInFlight, VkPresentModeKHR presentMode,
+                       VkDeviceSize globalUboSize)
+      : lveWindow{&window}, lveDevice{device}, requestedPresentMode{presentMode}, frames(checkFramesInFlight(framesInFlight)),
+        gpuProfiler{lveDevice, framesInFlight}, renderPassScope{gpuProfiler.scopeId("render pass")} {
         recreateSwapChain();
         createCommandBuffers();
+        createGlobalResources(globalUboSize);
+    }
+
+    Renderer::Renderer(Device &device, const VkExtent2D &extent, uint32_t framesInFlight, VkDeviceSize globalUboSize)
+      : lveWindow{nullptr}, lveDevice{device}, requestedPresentMode{VK_PRESENT_MODE_IMMEDIATE_KHR},
+        frames(checkFramesInFlight(framesInFlight)), gpuProfiler{lveDevice, framesInFlight},
+        renderPassScope{gpuProfiler.scopeId("render pass")} {
+        offscreen = MAKE_UNIQUE(OffscreenTarget, lveDevice, extent, framesInFlight);
+        createCommandBuffers();
+        createGlobalResources(globalUboSize);
     }
 
     Renderer::~Renderer() { freeCommandBuffers(); }
     DISABLE_WARNINGS_POP()
 
     void Renderer::recreateSwapChain() {
-        auto extent = lveWindow.getExtent();
+        assert(lveWindow != nullptr && "a headless renderer has no swap chain");
+        auto extent = lveWindow->getExtent();
         while(extent.width == 0 || extent.height == 0) {
-            extent = lveWindow.getExtent();
+            extent = lveWindow->getExtent();
             glfwWaitEvents();
         }
         vkDeviceWaitIdle(lveDevice.device());
 
         if(lveSwapChain == nullptr) {
-            lveSwapChain = MAKE_UNIQUE(SwapChain, lveDevice, extent);
+            lveSwapChain = MAKE_UNIQUE(SwapChain, lveDevice, extent, C_UI32T(frames.size()), requestedPresentMode);
         } else {
             std::shared_ptr<SwapChain> oldSwapChain = std::move(lveSwapChain);
-            lveSwapChain = MAKE_UNIQUE(SwapChain, lveDevice, extent, std::move(lveSwapChain));
+            lveSwapChain = MAKE_UNIQUE(SwapChain, lveDevice, extent, oldSwapChain, requestedPresentMode);
 
             if(!oldSwapChain->compareSwapFormats(*lveSwapChain.get())) {
                 throw std::runtime_error("Swap chain image(or depth) format has changed!");
@@ -34,8 +60,14 @@ namespace lve {
         }
     }
 
+    void Renderer::setPresentMode(VkPresentModeKHR mode) noexcept {
+        if(isHeadless()) { return; }
+        presentModeChanged = mode != requestedPresentMode || presentModeChanged;
+        requestedPresentMode = mode;
+    }
+
     void Renderer::createCommandBuffers() {
-        commandBuffers.resize(SwapChain::MAX_FRAMES_IN_FLIGHT);
+        std::vector<VkCommandBuffer> commandBuffers(frames.size());
         const VkCommandBufferAllocateInfo allocInfo{
             .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
             .commandPool = lveDevice.getCommandPool(),
@@ -44,17 +76,49 @@ namespace lve {
         };
 
         VK_CHECK(vkAllocateCommandBuffers(lveDevice.device(), &allocInfo, commandBuffers.data()), "failed to allocate command buffers!");
+        for(std::size_t i = 0; i < frames.size(); ++i) { frames[i].commandBuffer = commandBuffers[i]; }
     }
 
     void Renderer::freeCommandBuffers() noexcept {
+        std::vector<VkCommandBuffer> commandBuffers;
+        commandBuffers.reserve(frames.size());
+        for(FrameResources &frame : frames) {
+            if(frame.commandBuffer != VK_NULL_HANDLE) { commandBuffers.emplace_back(std::exchange(frame.commandBuffer, VK_NULL_HANDLE)); }
+        }
+        if(commandBuffers.empty()) { return; }
         vkFreeCommandBuffers(lveDevice.device(), lveDevice.getCommandPool(), C_UI32T(commandBuffers.size()), commandBuffers.data());
-        commandBuffers.clear();
+    }
+
+    void Renderer::createGlobalResources(VkDeviceSize globalUboSize) {
+        const auto frameCount = C_UI32T(frames.size());
+        globalSetLayout =
+            DescriptorSetLayout::Builder(lveDevice).addBinding(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_SHADER_STAGE_ALL_GRAPHICS).build();
+        globalPool = DescriptorPool::Builder(lveDevice)
+                         .setMaxSets(frameCount)
+                         .addPoolSize(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, frameCount)
+                         .build();
+        for(FrameResources &frame : frames) {
+            frame.globalUbo = MAKE_UNIQUE(Buffer, lveDevice, globalUboSize, 1, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+                                          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+            frame.globalUbo->map();
+            const auto bufferInfo = frame.globalUbo->descriptorInfo();
+            if(!DescriptorWriter(*globalSetLayout, *globalPool).writeBuffer(0, &bufferInfo).build(frame.globalDescriptorSet)) [[unlikely]] {
+                throw std::runtime_error("failed to allocate the global descriptor set!");
+            }
+        }
     }
 
     VkCommandBuffer Renderer::beginFrame() {
+        TRACE_SCOPE("Renderer::beginFrame");
         assert(!isFrameStarted && "Can't call beginFrame while already in progress");
+        if(presentModeChanged) [[unlikely]] {
+            presentModeChanged = false;
+            recreateSwapChain();
+            return nullptr;
+        }
 
-        const auto result = lveSwapChain->acquireNextImage(&currentImageIndex);
+        const auto result = offscreen ? offscreen->acquireNextImage(&currentImageIndex)
+                                      : lveSwapChain->acquireNextImage(&currentImageIndex);
         if(result == VK_ERROR_OUT_OF_DATE_KHR) {
             recreateSwapChain();
             return nullptr;
@@ -68,45 +132,59 @@ namespace lve {
         VkCommandBufferBeginInfo beginInfo{};
         beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
         VK_CHECK(vkBeginCommandBuffer(commandBuffer, &beginInfo), "failed to begin recording command buffer!");
+
+        ++frameNumber;
+        // the slot's fence has signaled, so the queries of its previous frame are available by now
+        gpuProfiler.beginFrame(commandBuffer, C_UI32T(currentFrameIndex), frameNumber);
         return commandBuffer;
     }
 
     void Renderer::endFrame() {
+        TRACE_SCOPE("Renderer::endFrame");
         assert(isFrameStarted && "Can't call endFrame while frame is not in progress");
         const auto commandBuffer = getCurrentCommandBuffer();
+        gpuProfiler.endFrame(commandBuffer);
         VK_CHECK(vkEndCommandBuffer(commandBuffer), "failed to record command buffer!");
 
-        const auto result = lveSwapChain->submitCommandBuffers(&commandBuffer, &currentImageIndex);
-        if(result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR || lveWindow.wasWindowResized()) {
-            lveWindow.resetWindowResizedFlag();
+        // pending uploads go first on the queue so this frame already sees them
+        lveDevice.staging().flush();
+        if(offscreen) {
+            VK_CHECK(offscreen->submitCommandBuffers(&commandBuffer, &currentImageIndex), "failed to submit offscreen frame!");
+        } else if(const auto result = lveSwapChain->submitCommandBuffers(&commandBuffer, &currentImageIndex);
+                  result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR || lveWindow->wasWindowResized()) {
+            lveWindow->resetWindowResizedFlag();
             recreateSwapChain();
         } else if(result != VK_SUCCESS) {
             throw std::runtime_error("failed to present swap chain image!");
         }
 
+        lveDevice.meshPool().endFrame();
         isFrameStarted = false;
-        currentFrameIndex = (currentFrameIndex + 1) % SwapChain::MAX_FRAMES_IN_FLIGHT;
+        currentFrameIndex = (currentFrameIndex + 1) % C_I(frames.size());
     }
     DISABLE_WARNINGS_PUSH(26446)
-    void Renderer::beginSwapChainRenderPass(VkCommandBuffer commandBuffer) noexcept {
+    void Renderer::beginSwapChainRenderPass(VkCommandBuffer commandBuffer, VkSubpassContents contents) noexcept {
         assert(isFrameStarted && "Can't call beginSwapChainRenderPass if frame is not in progress");
         assert(commandBuffer == getCurrentCommandBuffer() && "Can't begin render pass on command buffer from a different frame");
 
-        const auto swpextent = lveSwapChain->getSwapChainExtent();
+        const auto swpextent = targetExtent();
         std::array<VkClearValue, 2> clearValues{};
         clearValues[0].color = {0.01F, 0.01F, 0.01F, 1.0F};  // NOLINT(*-pro-type-union-access)
         clearValues[1].depthStencil = {1.0F, 0};             // NOLINT(*-pro-type-union-access)
         const VkRect2D renderArea{{0, 0}, swpextent};
         const VkRenderPassBeginInfo renderPassInfo{
             .sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
-            .renderPass = lveSwapChain->getRenderPass(),
-            .framebuffer = lveSwapChain->getFrameBuffer(C_I(currentImageIndex)),
+            .renderPass = getSwapChainRenderPass(),
+            .framebuffer = targetFramebuffer(),
             .renderArea = renderArea,
             .clearValueCount = C_UI32T(clearValues.size()),
             .pClearValues = clearValues.data(),
         };
 
-        vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+        renderPassQuery = gpuProfiler.beginScope(commandBuffer, renderPassScope);
+        vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, contents);
+        // only vkCmdExecuteCommands may follow in a subpass recorded from secondaries
+        if(contents != VK_SUBPASS_CONTENTS_INLINE) { return; }
 
         const VkViewport viewport{
             .x = 0.0f,
@@ -122,10 +200,23 @@ namespace lve {
     }
     DISABLE_WARNINGS_POP()
 
+    ParallelRecorder::PassInfo Renderer::getPassInfo() const noexcept {
+        assert(isFrameStarted && "Cannot get pass info when frame not in progress");
+        return ParallelRecorder::PassInfo{
+            .renderPass = getSwapChainRenderPass(), .framebuffer = targetFramebuffer(), .extent = targetExtent()};
+    }
+
+    VkExtent2D Renderer::targetExtent() const noexcept { return offscreen ? offscreen->getExtent() : lveSwapChain->getSwapChainExtent(); }
+
+    VkFramebuffer Renderer::targetFramebuffer() const noexcept {
+        return offscreen ? offscreen->getFrameBuffer(C_I(currentImageIndex)) : lveSwapChain->getFrameBuffer(C_I(currentImageIndex));
+    }
+
     void Renderer::endSwapChainRenderPass(VkCommandBuffer commandBuffer) noexcept {
         assert(isFrameStarted && "Can't call endSwapChainRenderPass if frame is not in progress");
         assert(commandBuffer == getCurrentCommandBuffer() && "Can't end render pass on command buffer from a different frame");
         vkCmdEndRenderPass(commandBuffer);
+        gpuProfiler.endScope(commandBuffer, std::exchange(renderPassQuery, GpuProfiler::INVALID_SCOPE));
     }
 }  // namespace lve
    // NOLINTEND(*-include-cleaner)
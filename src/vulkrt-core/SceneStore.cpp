@@ -0,0 +1,290 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/SceneStore.hpp"
+#include "vulkrt/TransformKernel.hpp"
+
+namespace lve {
+    DISABLE_WARNINGS_PUSH(26446)
+    void SceneStore::insert(GameObject &&object) {
+        const id_t id = object.get_id();
+        structureChange = ++changeCounter;
+        if(const uint32_t index = indexOf(id); index != INVALID_INDEX) [[unlikely]] {
+            translations_[index] = object.transform.translation;
+            rotations_[index] = object.transform.rotation;
+            scales_[index] = object.transform.scale;
+            colors_[index] = object.color;
+            models_[index] = std::move(object.model);
+            markDirty(index);
+            return;
+        }
+        if(id >= sparse.size()) { sparse.resize(C_ST(id) + 1, INVALID_INDEX); }
+        const auto index = C_UI32T(dense.size());
+        sparse[id] = index;
+        dense.emplace_back(id);
+        translations_.emplace_back(object.transform.translation);
+        rotations_.emplace_back(object.transform.rotation);
+        scales_.emplace_back(object.transform.scale);
+        colors_.emplace_back(object.color);
+        models_.emplace_back(std::move(object.model));
+        parents_.emplace_back(NO_PARENT);
+        localMatrices.emplace_back(1.0F);
+        localNormals.emplace_back(1.0F);
+        modelMatrices_.emplace_back(1.0F);
+        normalMatrices_.emplace_back(1.0F);
+        transformStamps.emplace_back(0);
+        dirty.emplace_back(0);
+        hierarchy.stale = true;
+        markDirty(index);
+    }
+
+    bool SceneStore::erase(id_t id) noexcept {
+        const uint32_t index = indexOf(id);
+        if(index == INVALID_INDEX) [[unlikely]] { return false; }
+        structureChange = ++changeCounter;
+        hierarchy.stale = true;
+        for(uint32_t child = 0; child < C_UI32T(parents_.size()); ++child) {
+            if(parents_[child] == id) {
+                parents_[child] = NO_PARENT;
+                markDirty(child);
+            }
+        }
+        const std::size_t last = dense.size() - 1;
+        if(index != last) {
+            dense[index] = dense[last];
+            translations_[index] = translations_[last];
+            rotations_[index] = rotations_[last];
+            scales_[index] = scales_[last];
+            colors_[index] = colors_[last];
+            models_[index] = std::move(models_[last]);
+            parents_[index] = parents_[last];
+            localMatrices[index] = localMatrices[last];
+            localNormals[index] = localNormals[last];
+            modelMatrices_[index] = modelMatrices_[last];
+            normalMatrices_[index] = normalMatrices_[last];
+            transformStamps[index] = transformStamps[last];
+            dirty[index] = dirty[last];
+            sparse[dense[index]] = index;
+        }
+        sparse[id] = INVALID_INDEX;
+        dense.pop_back();
+        translations_.pop_back();
+        rotations_.pop_back();
+        scales_.pop_back();
+        colors_.pop_back();
+        models_.pop_back();
+        parents_.pop_back();
+        localMatrices.pop_back();
+        localNormals.pop_back();
+        modelMatrices_.pop_back();
+        normalMatrices_.pop_back();
+        transformStamps.pop_back();
+        dirty.pop_back();
+        return true;
+    }
+
+    void SceneStore::clear() noexcept {
+        structureChange = ++changeCounter;
+        sparse.clear();
+        dense.clear();
+        translations_.clear();
+        rotations_.clear();
+        scales_.clear();
+        colors_.clear();
+        models_.clear();
+        parents_.clear();
+        localMatrices.clear();
+        localNormals.clear();
+        modelMatrices_.clear();
+        normalMatrices_.clear();
+        transformStamps.clear();
+        dirty.clear();
+        dirtyIds.clear();
+        hierarchy.stale = true;
+    }
+
+    void SceneStore::setModel(id_t id, std::shared_ptr<Model> model) noexcept {
+        if(const uint32_t index = indexOf(id); index != INVALID_INDEX) [[likely]] {
+            models_[index] = std::move(model);
+            structureChange = ++changeCounter;
+        }
+    }
+
+    void SceneStore::setTranslation(id_t id, const glm::vec3 &translation) noexcept {
+        if(const uint32_t index = indexOf(id); index != INVALID_INDEX) [[likely]] {
+            translations_[index] = translation;
+            markDirty(index);
+        }
+    }
+
+    void SceneStore::setRotation(id_t id, const glm::vec3 &rotation) noexcept {
+        if(const uint32_t index = indexOf(id); index != INVALID_INDEX) [[likely]] {
+            rotations_[index] = rotation;
+            markDirty(index);
+        }
+    }
+
+    void SceneStore::setScale(id_t id, const glm::vec3 &scale) noexcept {
+        if(const uint32_t index = indexOf(id); index != INVALID_INDEX) [[likely]] {
+            scales_[index] = scale;
+            markDirty(index);
+        }
+    }
+
+    void SceneStore::setTransform(id_t id, const TransformComponent &transform) noexcept {
+        if(const uint32_t index = indexOf(id); index != INVALID_INDEX) [[likely]] {
+            translations_[index] = transform.translation;
+            rotations_[index] = transform.rotation;
+            scales_[index] = transform.scale;
+            markDirty(index);
+        }
+    }
+
+    bool SceneStore::setParent(id_t child, id_t parent) noexcept {
+        const uint32_t index = indexOf(child);
+        if(index == INVALID_INDEX) [[unlikely]] { return false; }
+        if(parent != NO_PARENT) {
+            // walking up from parent must not reach child
+            for(id_t ancestor = parent; ancestor != NO_PARENT; ancestor = parents_[indexOf(ancestor)]) {
+                if(ancestor == child || !contains(ancestor)) [[unlikely]] { return false; }
+            }
+        }
+        if(parents_[index] == parent) { return true; }
+        parents_[index] = parent;
+        structureChange = ++changeCounter;
+        hierarchy.stale = true;
+        markDirty(index);
+        return true;
+    }
+
+    SceneStore::id_t SceneStore::parentOf(id_t id) const noexcept {
+        const uint32_t index = indexOf(id);
+        return index == INVALID_INDEX ? NO_PARENT : parents_[index];
+    }
+
+    void SceneStore::markDirty(uint32_t index) noexcept {
+        transformStamps[index] = ++changeCounter;
+        if(dirty[index] != 0) { return; }
+        dirty[index] = 1;
+        dirtyIds.emplace_back(dense[index]);
+    }
+
+    void SceneStore::rebuildHierarchy() {
+        const auto count = C_UI32T(dense.size());
+        // children of every object in compressed form: children[childStart[i], childStart[i + 1])
+        std::vector<uint32_t> childStart(C_ST(count) + 1, 0);
+        for(uint32_t i = 0; i < count; ++i) {
+            if(const uint32_t parent = indexOf(parents_[i]); parent != INVALID_INDEX) { ++childStart[parent + 1]; }
+        }
+        std::inclusive_scan(childStart.begin(), childStart.end(), childStart.begin());
+        std::vector<uint32_t> cursor(childStart.begin(), childStart.end() - 1);
+        std::vector<uint32_t> children(count);
+        for(uint32_t i = 0; i < count; ++i) {
+            if(const uint32_t parent = indexOf(parents_[i]); parent != INVALID_INDEX) { children[cursor[parent]++] = i; }
+        }
+
+        // iterative depth first walk, so deep hierarchies cannot overflow the call stack
+        hierarchy.index.clear();
+        hierarchy.parent.clear();
+        hierarchy.position.assign(count, INVALID_INDEX);
+        std::vector<std::pair<uint32_t, uint32_t>> stack;  // dense index, parent position
+        for(uint32_t i = count; i-- > 0;) {
+            if(parents_[i] == NO_PARENT) { stack.emplace_back(i, INVALID_INDEX); }
+        }
+        while(!stack.empty()) {
+            const auto [index, parentPosition] = stack.back();
+            stack.pop_back();
+            const auto position = C_UI32T(hierarchy.index.size());
+            hierarchy.index.emplace_back(index);
+            hierarchy.parent.emplace_back(parentPosition);
+            hierarchy.position[index] = position;
+            for(uint32_t child = childStart[index + 1]; child-- > childStart[index];) { stack.emplace_back(children[child], position); }
+        }
+        assert(hierarchy.index.size() == count && "hierarchy has a cycle");
+
+        // a subtree ends where the last of its descendants does
+        hierarchy.subtreeEnd.resize(count);
+        for(uint32_t position = 0; position < count; ++position) { hierarchy.subtreeEnd[position] = position + 1; }
+        for(uint32_t position = count; position-- > 0;) {
+            if(const uint32_t parent = hierarchy.parent[position]; parent != INVALID_INDEX) {
+                hierarchy.subtreeEnd[parent] = std::max(hierarchy.subtreeEnd[parent], hierarchy.subtreeEnd[position]);
+            }
+        }
+        hierarchy.stale = false;
+    }
+
+    void SceneStore::propagate(uint32_t begin, uint32_t end, stamp_t stamp) noexcept {
+        for(uint32_t position = begin; position < end; ++position) {
+            const uint32_t index = hierarchy.index[position];
+            if(const uint32_t parentPosition = hierarchy.parent[position]; parentPosition == INVALID_INDEX) {
+                modelMatrices_[index] = localMatrices[index];
+                normalMatrices_[index] = localNormals[index];
+            } else {
+                // (P * L)^-T = P^-T * L^-T, so normal matrices compose like model matrices
+                const uint32_t parent = hierarchy.index[parentPosition];
+                modelMatrices_[index] = modelMatrices_[parent] * localMatrices[index];
+                normalMatrices_[index] = normalMatrices_[parent] * localNormals[index];
+            }
+            transformStamps[index] = stamp;
+        }
+    }
+
+    std::size_t SceneStore::updateMatrices() {
+        if(dirtyIds.empty() && !hierarchy.stale) [[likely]] {
+            // nothing pending, so every change so far is in the matrices
+            matricesChange = changeCounter;
+            return 0;
+        }
+        // newer than every setter stamp folded into this update, so consumers that uploaded before see the change
+        const stamp_t stamp = ++changeCounter;
+        matricesChange = stamp;
+        updateIndices.clear();
+        updateTranslations.clear();
+        updateRotations.clear();
+        updateScales.clear();
+        for(const id_t id : dirtyIds) {
+            const uint32_t index = indexOf(id);
+            // erased, or listed twice after an erase and re-insert
+            if(index == INVALID_INDEX || dirty[index] == 0) [[unlikely]] { continue; }
+            dirty[index] = 0;
+            updateIndices.emplace_back(index);
+            updateTranslations.emplace_back(translations_[index]);
+            updateRotations.emplace_back(rotations_[index]);
+            updateScales.emplace_back(scales_[index]);
+        }
+        dirtyIds.clear();
+
+        updateModels.resize(updateIndices.size());
+        updateNormals.resize(updateIndices.size());
+        TransformKernel::compute(updateTranslations, updateRotations, updateScales, updateModels.data(), updateNormals.data());
+        for(std::size_t i = 0; i < updateIndices.size(); ++i) {
+            localMatrices[updateIndices[i]] = updateModels[i];
+            localNormals[updateIndices[i]] = updateNormals[i];
+        }
+
+        const auto count = C_UI32T(dense.size());
+        if(hierarchy.stale) {
+            rebuildHierarchy();
+            propagate(0, count, stamp);
+            return count;
+        }
+
+        // walk the subtrees of the dirty objects in preorder, skipping those nested in one already walked
+        updatePositions.clear();
+        for(const uint32_t index : updateIndices) { updatePositions.emplace_back(hierarchy.position[index]); }
+        std::ranges::sort(updatePositions);
+        std::size_t updated = 0;
+        uint32_t walkedEnd = 0;
+        for(const uint32_t position : updatePositions) {
+            if(position < walkedEnd) { continue; }
+            walkedEnd = hierarchy.subtreeEnd[position];
+            propagate(position, walkedEnd, stamp);
+            updated += walkedEnd - position;
+        }
+        return updated;
+    }
+    DISABLE_WARNINGS_POP()
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
@@ -3,6 +3,7 @@
 //
 
 #include "vulkrt/SimpleRenderSystem.hpp"
+#include "vulkrt/SwapChain.hpp"
 
 #include <vulkrt/timer/Timer.hpp>
 
@@ -15,8 +16,12 @@ namespace lve {
     DISABLE_WARNINGS_POP()
     DISABLE_WARNINGS_PUSH(26432 26447)
     static inline constexpr auto SIMPLE_PUSH_CONSTANT_DATA_SIZE = sizeof(SimplePushConstantData);
-    SimpleRenderSystem::SimpleRenderSystem(Device &device, VkRenderPass renderPass, VkDescriptorSetLayout globalSetLayout)
-      : lveDevice{device} {
+    static inline constexpr uint32_t INSTANCE_BINDING = 1;
+    static inline constexpr std::size_t MIN_INSTANCE_CAPACITY = 1024;
+
+    SimpleRenderSystem::SimpleRenderSystem(Device &device, VkRenderPass renderPass, VkDescriptorSetLayout globalSetLayout,
+                                           uint32_t framesInFlight, RenderMode renderMode)
+      : lveDevice{device}, mode{renderMode}, instanceBuffers(framesInFlight) {
         createPipelineLayout(globalSetLayout);
         createPipeline(renderPass);
     }
@@ -52,7 +57,14 @@ namespace lve {
         Pipeline::defaultPipelineConfigInfo(pipelineConfig);
         pipelineConfig.renderPass = renderPass;
         pipelineConfig.pipelineLayout = pipelineLayout;
-        const auto vertPath = Window::calculateRelativePathToSrcShaders(curentP, "simple_shader.vert.opt.rmp.spv").string();
+        const char *vertShader = "simple_shader.vert.opt.rmp.spv";
+        if(mode == RenderMode::Instanced) {
+            vertShader = "instanced_shader.vert.opt.rmp.spv";
+            pipelineConfig.bindingDescriptions.emplace_back(Model::InstanceData::getBindingDescription(INSTANCE_BINDING));
+            std::ranges::copy(Model::InstanceData::getAttributeDescriptions(INSTANCE_BINDING),
+                              std::back_inserter(pipelineConfig.attributeDescriptions));
+        }
+        const auto vertPath = Window::calculateRelativePathToSrcShaders(curentP, vertShader).string();
         // TODO: return to .frag.vert
         const auto fragPath = Window::calculateRelativePathToSrcShaders(curentP, "simple_shader.frag.opt.rmp.spv").string();
         lvePipeline = MAKE_UNIQUE(Pipeline, lveDevice, vertPath, fragPath, pipelineConfig);
@@ -63,25 +75,157 @@ namespace lve {
     static inline constexpr float DELTA_Y = 0.01F;
     static inline constexpr float DELAT_X = 0.005f;
 
+    void SimpleRenderSystem::setStatisticsEnabled(bool enabled) {
+        if(!enabled) {
+            statistics.reset();
+        } else if(statistics == nullptr) {
+            statistics = MAKE_UNIQUE(PipelineStatistics, lveDevice, C_UI32T(instanceBuffers.size()));
+        }
+    }
+
+    void SimpleRenderSystem::prepare(const FrameInfo &frameInfo) {
+        if(statistics) { statistics->reset(frameInfo.commandBuffer, C_UI32T(frameInfo.frameIndex)); }
+    }
+
     void SimpleRenderSystem::SimpleRenderSystem::renderGameObjects(FrameInfo& frameInfo) {
-        lvePipeline->bind(frameInfo.commandBuffer);
+        counters = {};
+        cullGameObjects(frameInfo);
+        if(visibleObjects.empty()) { return; }
+
+        const auto frameIndex = C_UI32T(frameInfo.frameIndex);
+        if(statistics) { statistics->begin(frameInfo.commandBuffer, frameIndex); }
+        bindPipeline(frameInfo, frameInfo.commandBuffer, counters);
+        if(mode == RenderMode::Instanced) {
+            renderInstanced(frameInfo, frameInfo.commandBuffer, counters);
+        } else {
+            renderPerObject(frameInfo, frameInfo.commandBuffer, 0, visibleObjects.size(), counters);
+        }
+        if(statistics) { statistics->end(frameInfo.commandBuffer, frameIndex); }
+    }
 
-        vkCmdBindDescriptorSets(frameInfo.commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, 1,
-                                &frameInfo.globalDescriptorSet, 0, nullptr);
+    void SimpleRenderSystem::renderGameObjects(FrameInfo &frameInfo, ParallelRecorder &recorder, const ParallelRecorder::PassInfo &pass) {
+        counters = {};
+        cullGameObjects(frameInfo);
+        if(visibleObjects.empty()) { return; }
+
+        if(mode == RenderMode::Instanced) {
+            // one draw per model, not worth splitting
+            recorder.record(frameInfo.commandBuffer, frameInfo.frameIndex, pass, 1,
+                            [this, &frameInfo](VkCommandBuffer commandBuffer, std::size_t, std::size_t) {
+                                bindPipeline(frameInfo, commandBuffer, counters);
+                                renderInstanced(frameInfo, commandBuffer, counters);
+                            });
+            return;
+        }
+        // chunks run concurrently, so they only see the frame as const and merge their counts under countersMutex
+        recorder.record(frameInfo.commandBuffer, frameInfo.frameIndex, pass, visibleObjects.size(),
+                        [this, &frameInfo = std::as_const(frameInfo)](VkCommandBuffer commandBuffer, std::size_t begin, std::size_t end) {
+                            DrawCounters chunkCounters{};
+                            bindPipeline(frameInfo, commandBuffer, chunkCounters);
+                            renderPerObject(frameInfo, commandBuffer, begin, end, chunkCounters);
+                            std::scoped_lock lock{countersMutex};
+                            counters += chunkCounters;
+                        });
+    }
 
-        for (auto& kv : frameInfo.gameObjects) {
-            auto& obj = kv.second;
-            if (obj.model == nullptr) { continue;}
+    void SimpleRenderSystem::bindPipeline(const FrameInfo &frameInfo, VkCommandBuffer commandBuffer,
+                                          DrawCounters &drawCounters) const noexcept {
+        lvePipeline->bind(commandBuffer);
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, 1, &frameInfo.globalDescriptorSet, 0,
+                                nullptr);
+        ++drawCounters.pipelineBinds;
+        ++drawCounters.descriptorBinds;
+    }
+
+    void SimpleRenderSystem::cullGameObjects(const FrameInfo &frameInfo) {
+        candidates.clear();
+        candidateSpheres.clear();
+        const SceneStore &scene = frameInfo.scene;
+        const auto models = scene.models();
+        const auto modelMatrices = scene.modelMatrices();
+        for(uint32_t index = 0; index < C_UI32T(models.size()); ++index) {
+            const Model *model = models[index].get();
+            if(model == nullptr || !model->isReady()) { continue; }
+            candidates.emplace_back(index);
+            candidateSpheres.push(FrustumCuller::transformSphere(modelMatrices[index], model->boundingSphere()));
+        }
+        visibleObjects.resize(candidates.size());
+        visibleObjects.resize(FrustumCuller::cull(frameInfo.camera.getFrustumPlanes(), candidateSpheres, visibleObjects.data()));
+        stats = FrustumCuller::Stats{.tested = C_UI32T(candidates.size()), .visible = C_UI32T(visibleObjects.size())};
+    }
+
+    void SimpleRenderSystem::renderPerObject(const FrameInfo &frameInfo, VkCommandBuffer commandBuffer, std::size_t begin,
+                                             std::size_t end, DrawCounters &drawCounters) const {
+        for(std::size_t i = begin; i < end; ++i) {
+            const uint32_t index = candidates[visibleObjects[i]];
+            const Model &model = *frameInfo.scene.models()[index];
             SimplePushConstantData push{};
-            push.modelMatrix = obj.transform.mat4();
-            push.normalMatrix = obj.transform.normalMatrix();
+            push.modelMatrix = frameInfo.scene.modelMatrices()[index];
+            push.normalMatrix = frameInfo.scene.normalMatrices()[index];
 
             // NOLINTNEXTLINE(*-signed-bitwise)
-            vkCmdPushConstants(frameInfo.commandBuffer, pipelineLayout, VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, 0,
+            vkCmdPushConstants(commandBuffer, pipelineLayout, VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, 0,
                                SIMPLE_PUSH_CONSTANT_DATA_SIZE, &push);
-            obj.model->bind(frameInfo.commandBuffer);
-            obj.model->draw(frameInfo.commandBuffer);
+            model.bind(commandBuffer);
+            model.draw(commandBuffer);
+        }
+        drawCounters.draws += C_UI32T(end - begin);
+        drawCounters.pushConstantBytes += (end - begin) * SIMPLE_PUSH_CONSTANT_DATA_SIZE;
+    }
+
+    void SimpleRenderSystem::renderInstanced(const FrameInfo &frameInfo, VkCommandBuffer commandBuffer, DrawCounters &drawCounters) {
+        // pass 1: count the visible instances of every model
+        groupIndex.clear();
+        groups.clear();
+        objectGroups.clear();
+        for(const uint32_t visible : visibleObjects) {
+            Model *model = frameInfo.scene.models()[candidates[visible]].get();
+            const auto [it, inserted] = groupIndex.try_emplace(model, C_UI32T(groups.size()));
+            if(inserted) { groups.emplace_back(DrawGroup{model, 0, 0}); }
+            ++groups[it->second].instanceCount;
+            objectGroups.emplace_back(it->second);
+        }
+
+        uint32_t instanceCount = 0;
+        for(auto &group : groups) {
+            group.firstInstance = instanceCount;
+            instanceCount += group.instanceCount;
+            group.instanceCount = 0;  // reused as write cursor below
+        }
+
+        // pass 2: write the matrices of each model contiguously, straight into mapped memory
+        Buffer &instanceBuffer = instanceBufferFor(frameInfo.frameIndex, instanceCount);
+        auto *instances = static_cast<Model::InstanceData *>(instanceBuffer.getMappedMemory());
+        const auto modelMatrices = frameInfo.scene.modelMatrices();
+        const auto normalMatrices = frameInfo.scene.normalMatrices();
+        for(std::size_t i = 0; i < visibleObjects.size(); ++i) {
+            const uint32_t index = candidates[visibleObjects[i]];
+            DrawGroup &drawGroup = groups[objectGroups[i]];
+            instances[drawGroup.firstInstance + drawGroup.instanceCount++] = {modelMatrices[index], normalMatrices[index]};
+        }
+        instanceBuffer.flush(C_UI64T(instanceCount) * sizeof(Model::InstanceData), 0);
+
+        const VkBuffer instanceVkBuffer = instanceBuffer.getBuffer();
+        const VkDeviceSize offset = 0;
+        vkCmdBindVertexBuffers(commandBuffer, INSTANCE_BINDING, 1, &instanceVkBuffer, &offset);
+        for(const auto &group : groups) {
+            group.model->bind(commandBuffer);
+            group.model->draw(commandBuffer, group.instanceCount, group.firstInstance);
+        }
+        drawCounters.draws += C_UI32T(groups.size());
+    }
+
+    Buffer &SimpleRenderSystem::instanceBufferFor(int frameIndex, std::size_t instanceCount) {
+        // no frame on the GPU still reads the slot's buffer, see Renderer::beginFrame
+        auto &buffer = instanceBuffers[C_ST(frameIndex)];
+        if(buffer == nullptr || buffer->getInstanceCount() < instanceCount) {
+            std::size_t capacity = buffer == nullptr ? MIN_INSTANCE_CAPACITY : buffer->getInstanceCount();
+            while(capacity < instanceCount) { capacity *= 2; }
+            buffer = MAKE_UNIQUE(Buffer, lveDevice, sizeof(Model::InstanceData), C_UI32T(capacity), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+                                 VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+            VK_CHECK(buffer->map(), "failed to map instance buffer!");
         }
+        return *buffer;
     }
 
     DISABLE_WARNINGS_POP()
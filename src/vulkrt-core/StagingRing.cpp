@@ -0,0 +1,259 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/StagingRing.hpp"
+
+namespace lve {
+    namespace {
+        // vkCmdCopyBuffer has no offset requirement, 16 keeps memcpy destinations vector aligned
+        constexpr VkDeviceSize COPY_ALIGNMENT = 16;
+
+        [[nodiscard]] constexpr uint64_t alignUp(uint64_t value, uint64_t alignment) noexcept {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+    }  // namespace
+
+    DISABLE_WARNINGS_PUSH(26446 26482)
+    StagingRing::StagingRing(Device &device, VkDeviceSize capacity) : lveDevice{device}, capacity{capacity} {
+        const QueueFamilyIndices families = lveDevice.findPhysicalQueueFamilies();
+        dedicatedTransfer = families.hasDedicatedTransfer();
+        transferFamily = dedicatedTransfer ? families.transferFamily : families.graphicsFamily;
+        graphicsFamily = families.graphicsFamily;
+
+        // NOLINTBEGIN(*-signed-bitwise)
+        lveDevice.createBuffer(capacity, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                               VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, buffer, allocation);
+        // NOLINTEND(*-signed-bitwise)
+        mapped = static_cast<std::byte *>(allocation.mapped);
+
+        const auto createPool = [this](uint32_t family) {
+            const VkCommandPoolCreateInfo poolInfo{.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+                                                   .flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
+                                                   .queueFamilyIndex = family};
+            VkCommandPool pool = VK_NULL_HANDLE;
+            VK_CHECK(vkCreateCommandPool(lveDevice.device(), &poolInfo, nullptr, &pool), "failed to create staging command pool!");
+            return pool;
+        };
+        const auto allocateCommands = [this](VkCommandPool pool) {
+            std::array<VkCommandBuffer, BATCH_COUNT> commandBuffers{};
+            const VkCommandBufferAllocateInfo allocInfo{.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+                                                        .commandPool = pool,
+                                                        .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+                                                        .commandBufferCount = C_UI32T(BATCH_COUNT)};
+            VK_CHECK(vkAllocateCommandBuffers(lveDevice.device(), &allocInfo, commandBuffers.data()),
+                     "failed to allocate staging command buffers!");
+            return commandBuffers;
+        };
+
+        transferPool = createPool(transferFamily);
+        const auto transferCommands = allocateCommands(transferPool);
+        std::array<VkCommandBuffer, BATCH_COUNT> acquireCommands{};
+        if(dedicatedTransfer) {
+            acquirePool = createPool(graphicsFamily);
+            acquireCommands = allocateCommands(acquirePool);
+        }
+
+        const VkFenceCreateInfo fenceInfo{.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO};
+        const VkSemaphoreCreateInfo semaphoreInfo{.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO};
+        for(std::size_t i = 0; i < BATCH_COUNT; ++i) {
+            Batch &batch = batches[i];
+            batch.transferCommands = transferCommands[i];
+            VK_CHECK(vkCreateFence(lveDevice.device(), &fenceInfo, nullptr, &batch.transferFence), "failed to create staging fence!");
+            if(dedicatedTransfer) {
+                batch.acquireCommands = acquireCommands[i];
+                VK_CHECK(vkCreateFence(lveDevice.device(), &fenceInfo, nullptr, &batch.acquireFence), "failed to create staging fence!");
+                VK_CHECK(vkCreateSemaphore(lveDevice.device(), &semaphoreInfo, nullptr, &batch.transferDone),
+                         "failed to create staging semaphore!");
+            }
+        }
+    }
+
+    StagingRing::~StagingRing() {
+        try {
+            waitIdle();
+        } catch(const std::exception &e) { LERROR("staging ring shutdown: {}", e.what()); }
+        for(const auto &batch : batches) {
+            vkDestroyFence(lveDevice.device(), batch.transferFence, nullptr);
+            vkDestroyFence(lveDevice.device(), batch.acquireFence, nullptr);
+            vkDestroySemaphore(lveDevice.device(), batch.transferDone, nullptr);
+        }
+        vkDestroyCommandPool(lveDevice.device(), transferPool, nullptr);
+        vkDestroyCommandPool(lveDevice.device(), acquirePool, nullptr);
+        lveDevice.destroyBuffer(buffer, allocation);
+    }
+
+    UploadToken StagingRing::upload(VkBuffer dstBuffer, VkDeviceSize dstOffset, const void *data, VkDeviceSize size,
+                                    VkPipelineStageFlags dstStage, VkAccessFlags dstAccess, VkSharingMode dstSharing) {
+        if(size == 0) [[unlikely]] { return {}; }
+        const std::scoped_lock lock{mutex};
+        collect(false);
+
+        UploadToken token{};
+        const auto *src = static_cast<const std::byte *>(data);
+        const VkDeviceSize maxChunk = capacity / 2;
+        for(VkDeviceSize done = 0; done < size;) {
+            const VkDeviceSize chunk = std::min(maxChunk, size - done);
+            const VkDeviceSize ringOffset = reserve(chunk);
+            Batch &batch = openBatch();
+
+            std::memcpy(mapped + ringOffset, src + done, chunk);
+            const VkBufferCopy region{.srcOffset = ringOffset, .dstOffset = dstOffset + done, .size = chunk};
+            vkCmdCopyBuffer(batch.transferCommands, buffer, dstBuffer, 1, &region);
+            batch.dstStages |= dstStage;
+            batch.dstAccess |= dstAccess;
+            if(dedicatedTransfer && dstSharing == VK_SHARING_MODE_EXCLUSIVE) {
+                batch.ownershipBarriers.emplace_back(VkBufferMemoryBarrier{.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+                                                                           .srcQueueFamilyIndex = transferFamily,
+                                                                           .dstQueueFamilyIndex = graphicsFamily,
+                                                                           .buffer = dstBuffer,
+                                                                           .offset = region.dstOffset,
+                                                                           .size = chunk});
+            }
+            token.serial = batch.serial;
+            done += chunk;
+        }
+        return token;
+    }
+
+    void StagingRing::flush() {
+        const std::scoped_lock lock{mutex};
+        collect(false);
+        if(batches[current].state == BatchState::Recording) { submit(batches[current]); }
+    }
+
+    void StagingRing::waitIdle() {
+        const std::scoped_lock lock{mutex};
+        if(batches[current].state == BatchState::Recording) { submit(batches[current]); }
+        while(batches[oldest].state == BatchState::Transferring) { collect(true); }
+        for(auto &batch : batches) { waitAcquire(batch); }
+    }
+
+    VkDeviceSize StagingRing::reserve(VkDeviceSize size) {
+        for(;;) {
+            // everything retired: restart at the beginning of the ring instead of wrapping around mid-way
+            if(head == tail) { head = tail = alignUp(head, capacity); }
+            const uint64_t pos = head % capacity;
+            uint64_t padding = alignUp(pos, COPY_ALIGNMENT) - pos;
+            if(pos + padding + size > capacity) { padding = capacity - pos; }
+            if(capacity - (head - tail) >= padding + size) {
+                head += padding + size;
+                return (head - size) % capacity;
+            }
+            // out of room: the open batch has to be submitted before its space can ever be reclaimed
+            if(batches[current].state == BatchState::Recording) { submit(batches[current]); }
+            collect(true);
+        }
+    }
+
+    StagingRing::Batch &StagingRing::openBatch() {
+        Batch &batch = batches[current];
+        if(batch.state == BatchState::Recording) { return batch; }
+        while(batch.state == BatchState::Transferring) { collect(true); }
+        waitAcquire(batch);
+
+        VK_CHECK(vkResetFences(lveDevice.device(), 1, &batch.transferFence), "failed to reset staging fence!");
+        VK_CHECK(vkResetCommandBuffer(batch.transferCommands, 0), "failed to reset staging command buffer!");
+        const VkCommandBufferBeginInfo beginInfo{.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+                                                 .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT};
+        VK_CHECK(vkBeginCommandBuffer(batch.transferCommands, &beginInfo), "failed to begin staging command buffer!");
+        batch.serial = ++lastSerial;
+        batch.dstStages = 0;
+        batch.dstAccess = 0;
+        batch.ownershipBarriers.clear();
+        batch.state = BatchState::Recording;
+        return batch;
+    }
+
+    void StagingRing::submit(Batch &batch) {
+        VkSubmitInfo submitInfo{.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO, .commandBufferCount = 1, .pCommandBuffers = &batch.transferCommands};
+        if(dedicatedTransfer) {
+            // release half of the ownership transfer, the acquire half is recorded once the copies are done
+            for(auto &barrier : batch.ownershipBarriers) {
+                barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+                barrier.dstAccessMask = 0;
+            }
+            if(!batch.ownershipBarriers.empty()) {
+                vkCmdPipelineBarrier(batch.transferCommands, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0,
+                                     nullptr, C_UI32T(batch.ownershipBarriers.size()), batch.ownershipBarriers.data(), 0, nullptr);
+            }
+            submitInfo.signalSemaphoreCount = 1;
+            submitInfo.pSignalSemaphores = &batch.transferDone;
+        } else {
+            // one barrier for the whole batch, later submissions on this queue see the copies
+            const VkMemoryBarrier barrier{.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+                                          .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+                                          .dstAccessMask = batch.dstAccess};
+            vkCmdPipelineBarrier(batch.transferCommands, VK_PIPELINE_STAGE_TRANSFER_BIT, batch.dstStages, 0, 1, &barrier, 0, nullptr, 0,
+                                 nullptr);
+        }
+        VK_CHECK(vkEndCommandBuffer(batch.transferCommands), "failed to record staging command buffer!");
+        VK_CHECK(vkQueueSubmit(lveDevice.transferQueue(), 1, &submitInfo, batch.transferFence), "failed to submit staging batch!");
+
+        batch.ringEnd = head;
+        batch.state = BatchState::Transferring;
+        ++submits;
+        current = (current + 1) % BATCH_COUNT;
+        if(!dedicatedTransfer) { readySerial.store(batch.serial, std::memory_order_release); }
+    }
+
+    void StagingRing::submitAcquire(Batch &batch) {
+        VK_CHECK(vkResetFences(lveDevice.device(), 1, &batch.acquireFence), "failed to reset staging fence!");
+        VK_CHECK(vkResetCommandBuffer(batch.acquireCommands, 0), "failed to reset staging command buffer!");
+        const VkCommandBufferBeginInfo beginInfo{.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+                                                 .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT};
+        VK_CHECK(vkBeginCommandBuffer(batch.acquireCommands, &beginInfo), "failed to begin staging command buffer!");
+        for(auto &barrier : batch.ownershipBarriers) {
+            barrier.srcAccessMask = 0;
+            barrier.dstAccessMask = batch.dstAccess;
+        }
+        // a batch of concurrent destinations only has the semaphore wait, which already makes the copies visible
+        if(!batch.ownershipBarriers.empty()) {
+            vkCmdPipelineBarrier(batch.acquireCommands, batch.dstStages, batch.dstStages, 0, 0, nullptr,
+                                 C_UI32T(batch.ownershipBarriers.size()), batch.ownershipBarriers.data(), 0, nullptr);
+        }
+        VK_CHECK(vkEndCommandBuffer(batch.acquireCommands), "failed to record staging command buffer!");
+
+        // the copies have already completed, so this wait never holds the graphics queue back
+        const VkSubmitInfo submitInfo{.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+                                      .waitSemaphoreCount = 1,
+                                      .pWaitSemaphores = &batch.transferDone,
+                                      .pWaitDstStageMask = &batch.dstStages,
+                                      .commandBufferCount = 1,
+                                      .pCommandBuffers = &batch.acquireCommands};
+        VK_CHECK(vkQueueSubmit(lveDevice.graphicsQueue(), 1, &submitInfo, batch.acquireFence), "failed to submit ownership acquire!");
+        batch.state = BatchState::Acquiring;
+        readySerial.store(batch.serial, std::memory_order_release);
+    }
+
+    void StagingRing::collect(bool wait) {
+        while(batches[oldest].state == BatchState::Transferring) {
+            Batch &batch = batches[oldest];
+            if(wait) {
+                VK_CHECK(vkWaitForFences(lveDevice.device(), 1, &batch.transferFence, VK_TRUE, std::numeric_limits<uint64_t>::max()),
+                         "failed to wait for staging fence!");
+            } else if(vkGetFenceStatus(lveDevice.device(), batch.transferFence) != VK_SUCCESS) {
+                return;
+            }
+            tail = batch.ringEnd;
+            if(dedicatedTransfer) {
+                submitAcquire(batch);
+            } else {
+                batch.state = BatchState::Idle;
+            }
+            oldest = (oldest + 1) % BATCH_COUNT;
+            // a blocking collect retires exactly one batch, callers loop as needed
+            if(wait) { return; }
+        }
+    }
+
+    void StagingRing::waitAcquire(Batch &batch) {
+        if(batch.state != BatchState::Acquiring) { return; }
+        VK_CHECK(vkWaitForFences(lveDevice.device(), 1, &batch.acquireFence, VK_TRUE, std::numeric_limits<uint64_t>::max()),
+                 "failed to wait for staging fence!");
+        batch.state = BatchState::Idle;
+    }
+    DISABLE_WARNINGS_POP()
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
@@ -4,12 +4,15 @@
 
 namespace lve {
     DISABLE_WARNINGS_PUSH(26429 26432 26447 26461 26446 26485)
-    SwapChain::SwapChain(Device &deviceRef, const VkExtent2D &extent) noexcept : device{deviceRef}, windowExtent{extent} {
+    SwapChain::SwapChain(Device &deviceRef, const VkExtent2D &extent, uint32_t frameCount, VkPresentModeKHR mode) noexcept
+      : device{deviceRef}, windowExtent{extent}, framesInFlight{frameCount}, requestedPresentMode{mode} {
+        assert(framesInFlight >= 1 && framesInFlight <= MAX_FRAMES_IN_FLIGHT && "frames in flight out of range");
         init();
     }
 
-    SwapChain::SwapChain(Device &deviceRef, const VkExtent2D &extent, std::shared_ptr<SwapChain> previous)
-      : device{deviceRef}, windowExtent{extent}, oldSwapChain{std::move(previous)} {
+    SwapChain::SwapChain(Device &deviceRef, const VkExtent2D &extent, std::shared_ptr<SwapChain> previous, VkPresentModeKHR mode)
+      : device{deviceRef}, windowExtent{extent}, framesInFlight{previous->framesInFlight}, requestedPresentMode{mode},
+        oldSwapChain{std::move(previous)} {
         init();
         oldSwapChain = nullptr;
     }
@@ -35,8 +38,7 @@ namespace lve {
 
         for(int i = 0; i < depthImages.size(); i++) {
             vkDestroyImageView(device_device, depthImageViews[i], nullptr);
-            vkDestroyImage(device_device, depthImages[i], nullptr);
-            vkFreeMemory(device_device, depthImageMemorys[i], nullptr);
+            device.destroyImage(depthImages[i], depthImageAllocations[i]);
         }
 
         for(auto *const framebuffer : swapChainFramebuffers) { vkDestroyFramebuffer(device_device, framebuffer, nullptr); }
@@ -44,7 +46,7 @@ namespace lve {
         vkDestroyRenderPass(device_device, renderPass, nullptr);
 
         // cleanup synchronization objects
-        for(size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
+        for(size_t i = 0; i < framesInFlight; i++) {
             vkDestroySemaphore(device_device, renderFinishedSemaphores[i], nullptr);
             vkDestroySemaphore(device_device, imageAvailableSemaphores[i], nullptr);
             vkDestroyFence(device_device, inFlightFences[i], nullptr);
@@ -102,7 +104,7 @@ namespace lve {
 
         const auto result = vkQueuePresentKHR(device.presentQueue(), &presentInfo);
 
-        currentFrame = (currentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
+        currentFrame = (currentFrame + 1) % framesInFlight;
 
         return result;
     }
@@ -112,7 +114,7 @@ namespace lve {
         const SwapChainSupportDetails swapChainSupport = device.getSwapChainSupport();
 
         const VkSurfaceFormatKHR surfaceFormat = chooseSwapSurfaceFormat(swapChainSupport.formats);
-        const VkPresentModeKHR presentMode = chooseSwapPresentMode(swapChainSupport.presentModes);
+        presentMode = chooseSwapPresentMode(swapChainSupport.presentModes);
         const VkExtent2D extent = chooseSwapExtent(swapChainSupport.capabilities);
 
         uint32_t imageCount = swapChainSupport.capabilities.minImageCount + 1;
@@ -282,7 +284,7 @@ namespace lve {
         const auto device_device = device.device();
 
         depthImages.resize(imagectn);
-        depthImageMemorys.resize(imagectn);
+        depthImageAllocations.resize(imagectn);
         depthImageViews.resize(imagectn);
 
         for(int i = 0; i < depthImages.size(); i++) {
@@ -302,7 +304,7 @@ namespace lve {
             imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
             imageInfo.flags = 0;
 
-            device.createImageWithInfo(imageInfo, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, depthImages[i], depthImageMemorys[i]);
+            device.createImageWithInfo(imageInfo, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, depthImages[i], depthImageAllocations[i]);
 
             VkImageViewCreateInfo viewInfo{};
             viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
@@ -321,9 +323,9 @@ namespace lve {
 
     void SwapChain::createSyncObjects() {
         const auto device_device = device.device();
-        imageAvailableSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
-        renderFinishedSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
-        inFlightFences.resize(MAX_FRAMES_IN_FLIGHT);
+        imageAvailableSemaphores.resize(framesInFlight);
+        renderFinishedSemaphores.resize(framesInFlight);
+        inFlightFences.resize(framesInFlight);
         imagesInFlight.resize(imageCount(), VK_NULL_HANDLE);
 
         VkSemaphoreCreateInfo semaphoreInfo = {};
@@ -333,7 +335,7 @@ namespace lve {
         fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
         fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
 
-        for(size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
+        for(size_t i = 0; i < framesInFlight; i++) {
             VK_CHECK_SYNC_OBJECTS(vkCreateSemaphore(device_device, &semaphoreInfo, nullptr, &imageAvailableSemaphores[i]),
                                   vkCreateSemaphore(device_device, &semaphoreInfo, nullptr, &renderFinishedSemaphores[i]),
                                   vkCreateFence(device_device, &fenceInfo, nullptr, &inFlightFences[i]),
@@ -358,22 +360,24 @@ namespace lve {
 #ifdef INDEPTH
         const vnd::AutoTimer timer{"chooseSwapPresentMode", vnd::Timer::Big};
 #endif
-        // Prefer VK_PRESENT_MODE_MAILBOX_KHR if available
-        // if(std::ranges::find(availablePresentModes, VK_PRESENT_MODE_MAILBOX_KHR) != availablePresentModes.end()) {
-        //     LINFO("Present mode: Mailbox");
-        //     return VK_PRESENT_MODE_MAILBOX_KHR;
-        // }
-
-        // Fallback to VK_PRESENT_MODE_IMMEDIATE_KHR if needed
-        // This code is commented out in your example, but if you want to enable it, you can use the following:
-        if(std::ranges::find(availablePresentModes, VK_PRESENT_MODE_IMMEDIATE_KHR) != availablePresentModes.end()) {
-            LINFO("Present mode: Immediate");
-            return VK_PRESENT_MODE_IMMEDIATE_KHR;
+        const auto available = [&](VkPresentModeKHR mode) {
+            return std::ranges::find(availablePresentModes, mode) != availablePresentModes.end();
+        };
+        VkPresentModeKHR chosen = VK_PRESENT_MODE_FIFO_KHR;  // V-Sync, the only mode every surface supports
+        if(available(requestedPresentMode)) [[likely]] {
+            chosen = requestedPresentMode;
+        } else if(requestedPresentMode == VK_PRESENT_MODE_MAILBOX_KHR && available(VK_PRESENT_MODE_IMMEDIATE_KHR)) {
+            chosen = VK_PRESENT_MODE_IMMEDIATE_KHR;
+        } else if(requestedPresentMode == VK_PRESENT_MODE_IMMEDIATE_KHR && available(VK_PRESENT_MODE_MAILBOX_KHR)) {
+            chosen = VK_PRESENT_MODE_MAILBOX_KHR;
         }
-
-        // Default to VK_PRESENT_MODE_FIFO_KHR (V-Sync)
-        LINFO("Present mode: V-Sync");
-        return VK_PRESENT_MODE_FIFO_KHR;
+        if(chosen != requestedPresentMode) [[unlikely]] {
+            LWARN("Present mode {} is not supported, using {}", string_VkPresentModeKHR(requestedPresentMode),
+                  string_VkPresentModeKHR(chosen));
+        } else {
+            LINFO("Present mode: {}", string_VkPresentModeKHR(chosen));
+        }
+        return chosen;
     }
 
     VkExtent2D SwapChain::chooseSwapExtent(const VkSurfaceCapabilitiesKHR &capabilities) const noexcept {
@@ -0,0 +1,41 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/ThreadPool.hpp"
+#include "vulkrt/timer/TraceProfiler.hpp"
+
+namespace lve {
+
+    ThreadPool::ThreadPool(std::size_t threadCount) {
+        if(threadCount == 0) { threadCount = std::max(2U, std::thread::hardware_concurrency()) - 1; }
+        workers.reserve(threadCount);
+        for(std::size_t i = 0; i < threadCount; ++i) {
+            workers.emplace_back([this](const std::stop_token &stopToken) { workerLoop(stopToken); });
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        for(auto &worker : workers) { worker.request_stop(); }
+        condition.notify_all();
+        workers.clear();
+    }
+
+    void ThreadPool::workerLoop(const std::stop_token &stopToken) {
+        vnd::TraceProfiler::setThreadName("pool worker");
+        while(!stopToken.stop_requested()) {
+            std::function<void()> job;
+            {
+                std::unique_lock lock{mutex};
+                if(!condition.wait(lock, stopToken, [this] { return !jobs.empty(); })) { return; }
+                job = std::move(jobs.front());
+                jobs.pop_front();
+            }
+            try {
+                job();
+            } catch(const std::exception &e) { LERROR("unhandled exception in worker job: {}", e.what()); }
+        }
+    }
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
@@ -0,0 +1,193 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/timer/TraceProfiler.hpp"
+
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+namespace vnd {
+    namespace {
+        // fields are atomics so the writer can read them while the owning thread overwrites old slots
+        struct Event {
+            std::atomic<const char *> name{nullptr};
+            std::atomic<std::int64_t> beginNs{0};
+            std::atomic<std::int64_t> durationNs{0};
+        };
+
+        struct ThreadRing {
+            std::unique_ptr<Event[]> events = std::make_unique<Event[]>(TraceProfiler::RING_CAPACITY);  // NOLINT(*-avoid-c-arrays)
+            std::atomic<std::uint64_t> written{0};
+            std::atomic<bool> alive{true};  ///< cleared when the owning thread exits
+            std::uint32_t tid = 0;
+            std::string name;  // guarded by Registry::mutex
+        };
+
+        struct Registry {
+            std::mutex mutex;
+            std::vector<std::shared_ptr<ThreadRing>> rings;
+            std::unordered_set<std::string> names;
+            std::uint32_t nextTid = 1;
+            TraceProfiler::clock::time_point epoch = TraceProfiler::clock::now();
+        };
+
+        Registry &registry() {
+            static Registry instance;
+            return instance;
+        }
+
+        // the ring is only allocated by the first event of the thread, threads that never trace cost a name at most
+        struct ThreadState {
+            std::string name;
+            std::shared_ptr<ThreadRing> ring;
+
+            ThreadState() = default;
+            ThreadState(const ThreadState &) = delete;
+            ThreadState &operator=(const ThreadState &) = delete;
+            ThreadState(ThreadState &&) = delete;
+            ThreadState &operator=(ThreadState &&) = delete;
+            ~ThreadState() {
+                if(ring) { ring->alive.store(false, std::memory_order_release); }
+            }
+        };
+
+        ThreadState &threadState() noexcept {
+            thread_local ThreadState state;
+            return state;
+        }
+
+        ThreadRing &threadRing() {
+            ThreadState &state = threadState();
+            if(!state.ring) [[unlikely]] {
+                auto created = std::make_shared<ThreadRing>();
+                Registry &reg = registry();
+                const std::scoped_lock lock{reg.mutex};
+                created->tid = reg.nextTid++;
+                created->name = state.name;
+                reg.rings.emplace_back(created);
+                state.ring = std::move(created);
+            }
+            return *state.ring;
+        }
+
+        void writeJsonString(std::ostream &out, std::string_view text) {
+            out << '"';
+            for(const char c : text) {
+                if(c == '"' || c == '\\') {
+                    out << '\\' << c;
+                } else if(C_UI32T(static_cast<unsigned char>(c)) < 0x20) {
+                    out << FORMAT("\\u{:04x}", C_UI32T(static_cast<unsigned char>(c)));
+                } else {
+                    out << c;
+                }
+            }
+            out << '"';
+        }
+    }  // namespace
+
+    void TraceProfiler::setEnabled(bool enable) noexcept {
+        (void)registry();  // the epoch starts no later than the first event
+        enabled.store(enable, std::memory_order_relaxed);
+    }
+
+    DISABLE_WARNINGS_PUSH(26446 26481)
+    void TraceProfiler::record(const char *name, clock::time_point begin, clock::time_point end) noexcept {
+        ThreadRing &ring = threadRing();
+        const std::uint64_t index = ring.written.load(std::memory_order_relaxed);
+        Event &event = ring.events[index % RING_CAPACITY];
+        // pairs with the acquire fence in writeChromeTrace: a reader that sees any field of this write also sees
+        // written >= index, so it knows the slot may be torn
+        std::atomic_thread_fence(std::memory_order_release);
+        event.name.store(name, std::memory_order_relaxed);
+        event.beginNs.store(ch::duration_cast<ch::nanoseconds>(begin - registry().epoch).count(), std::memory_order_relaxed);
+        event.durationNs.store(ch::duration_cast<ch::nanoseconds>(end - begin).count(), std::memory_order_relaxed);
+        ring.written.store(index + 1, std::memory_order_release);
+    }
+
+    const char *TraceProfiler::intern(std::string_view name) {
+        Registry &reg = registry();
+        const std::scoped_lock lock{reg.mutex};
+        return reg.names.emplace(name).first->c_str();
+    }
+
+    void TraceProfiler::setThreadName(std::string_view name) {
+        ThreadState &state = threadState();
+        state.name = name;
+        if(state.ring) {
+            const std::scoped_lock lock{registry().mutex};
+            state.ring->name = name;
+        }
+    }
+
+    std::size_t TraceProfiler::writeChromeTrace(const fs::path &filepath) {
+        std::ofstream out{filepath};
+        if(!out) [[unlikely]] { throw std::runtime_error(FORMAT("cannot write trace {}", filepath.string())); }
+
+        Registry &reg = registry();
+        std::vector<std::shared_ptr<ThreadRing>> rings;
+        std::vector<std::string> threadNames;
+        {
+            const std::scoped_lock lock{reg.mutex};
+            std::erase_if(reg.rings, [](const std::shared_ptr<ThreadRing> &ring) {
+                return !ring->alive.load(std::memory_order_acquire) && ring->written.load(std::memory_order_acquire) == 0;
+            });
+            rings = reg.rings;
+            for(const auto &ring : rings) { threadNames.emplace_back(ring->name); }
+        }
+
+        const auto pid = 1;
+        std::size_t count = 0;
+        bool first = true;
+        const auto separator = [&out, &first] {
+            out << (first ? "\n" : ",\n");
+            first = false;
+        };
+        out << R"({"displayTimeUnit": "ms", "traceEvents": [)";
+        for(std::size_t r = 0; r < rings.size(); ++r) {
+            const ThreadRing &ring = *rings[r];
+            if(!threadNames[r].empty()) {
+                separator();
+                out << FORMAT(R"({{"ph": "M", "name": "thread_name", "pid": {}, "tid": {}, "args": {{"name": )", pid, ring.tid);
+                writeJsonString(out, threadNames[r]);
+                out << "}}";
+            }
+
+            struct Copy {
+                const char *name;
+                std::int64_t beginNs;
+                std::int64_t durationNs;
+            };
+            const std::uint64_t end = ring.written.load(std::memory_order_acquire);
+            const std::uint64_t begin = end > RING_CAPACITY ? end - RING_CAPACITY : 0;
+            std::vector<Copy> events;
+            events.reserve(C_ST(end - begin));
+            for(std::uint64_t i = begin; i < end; ++i) {
+                const Event &event = ring.events[i % RING_CAPACITY];
+                events.emplace_back(Copy{event.name.load(std::memory_order_relaxed), event.beginNs.load(std::memory_order_relaxed),
+                                         event.durationNs.load(std::memory_order_relaxed)});
+            }
+            // slots the thread reused while they were copied may mix two events, drop them. The thread may be midway
+            // through writing event `after`, whose slot is the one of event after - RING_CAPACITY, so that one goes too
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const std::uint64_t after = ring.written.load(std::memory_order_relaxed);
+            const std::uint64_t firstValid = after + 1 > RING_CAPACITY ? std::max(begin, after + 1 - RING_CAPACITY) : begin;
+            for(std::uint64_t i = firstValid; i < end; ++i) {
+                const Copy &event = events[C_ST(i - begin)];
+                separator();
+                out << R"({"ph": "X", "name": )";
+                writeJsonString(out, event.name);
+                out << FORMAT(R"(, "pid": {}, "tid": {}, "ts": {:.3f}, "dur": {:.3f}}})", pid, ring.tid, C_D(event.beginNs) / 1000.0,
+                              C_D(event.durationNs) / 1000.0);
+                ++count;
+            }
+        }
+        out << "\n]}\n";
+        LINFO("trace: {} events of {} threads written to {}", count, rings.size(), filepath.string());
+        return count;
+    }
+    DISABLE_WARNINGS_POP()
+
+}  // namespace vnd
+   // NOLINTEND(*-include-cleaner)
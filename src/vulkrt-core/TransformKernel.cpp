@@ -0,0 +1,218 @@
+//
+// Created by gbian on 17/10/2026.
+//
+// NOLINTBEGIN(*-include-cleaner)
+#include "vulkrt/TransformKernel.hpp"
+#include "vulkrt/GameObject.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define VULKRT_TRANSFORM_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VULKRT_TRANSFORM_SSE
+#endif
+
+namespace lve {
+    DISABLE_WARNINGS_PUSH(26446 26481 26482)
+    namespace {
+        // Cephes sinf/cosf: reduction by pi/4 in three parts, then minimax polynomials on [-pi/4, pi/4]
+        [[maybe_unused]] constexpr float FOUR_OVER_PI = 1.27323954473516F;
+        [[maybe_unused]] constexpr float DP1 = -0.78515625F;
+        [[maybe_unused]] constexpr float DP2 = -2.4187564849853515625e-4F;
+        [[maybe_unused]] constexpr float DP3 = -3.77489497744594108e-8F;
+        [[maybe_unused]] constexpr float SIN_P0 = -1.9515295891e-4F;
+        [[maybe_unused]] constexpr float SIN_P1 = 8.3321608736e-3F;
+        [[maybe_unused]] constexpr float SIN_P2 = -1.6666654611e-1F;
+        [[maybe_unused]] constexpr float COS_P0 = 2.443315711809948e-5F;
+        [[maybe_unused]] constexpr float COS_P1 = -1.388731625493765e-3F;
+        [[maybe_unused]] constexpr float COS_P2 = 4.166664568298827e-2F;
+        // the three part reduction loses accuracy past this magnitude, such lane groups fall back to std::sin/std::cos
+        [[maybe_unused]] constexpr float REDUCTION_LIMIT = 8192.F;
+
+        struct Trig {
+            float c1, s1;  // rotation.y
+            float c2, s2;  // rotation.x
+            float c3, s3;  // rotation.z
+        };
+
+        Trig scalarTrig(const glm::vec3 &rotation) noexcept {
+            return Trig{.c1 = std::cos(rotation.y),
+                        .s1 = std::sin(rotation.y),
+                        .c2 = std::cos(rotation.x),
+                        .s2 = std::sin(rotation.x),
+                        .c3 = std::cos(rotation.z),
+                        .s3 = std::sin(rotation.z)};
+        }
+
+        // same terms as TransformComponent::computeMat4 and computeNormalMatrix
+        inline void assemble(const glm::vec3 &translation, const glm::vec3 &scale, const Trig &t, glm::mat4 &model,
+                             glm::mat4 &normal) noexcept {
+            const float mc13 = t.c1 * t.c3;
+            const float ms23 = t.s2 * t.s3;
+            const float mcs31 = t.c3 * t.s1;
+            const glm::vec3 col0{mc13 + t.s1 * ms23, t.c2 * t.s3, t.c1 * ms23 - mcs31};
+            const glm::vec3 col1{mcs31 * t.s2 - t.c1 * t.s3, t.c2 * t.c3, mc13 * t.s2 + t.s1 * t.s3};
+            const glm::vec3 col2{t.c2 * t.s1, -t.s2, t.c1 * t.c2};
+            const glm::vec3 invScale = 1.0F / scale;
+            model = glm::mat4{glm::vec4{col0 * scale.x, 0.F}, glm::vec4{col1 * scale.y, 0.F}, glm::vec4{col2 * scale.z, 0.F},
+                              glm::vec4{translation, 1.F}};
+            normal = glm::mat4{glm::vec4{col0 * invScale.x, 0.F}, glm::vec4{col1 * invScale.y, 0.F},
+                               glm::vec4{col2 * invScale.z, 0.F}, glm::vec4{0.F}};
+        }
+
+#if defined(VULKRT_TRANSFORM_AVX2)
+        constexpr std::size_t LANES = 8;
+        using Float = __m256;
+
+        inline void sincos(const Float angle, Float &sine, Float &cosine) noexcept {
+            const Float signMask = _mm256_castsi256_ps(_mm256_set1_epi32(C_I32T(0x80000000U)));
+            Float sinSign = _mm256_and_ps(angle, signMask);
+            Float x = _mm256_andnot_ps(signMask, angle);
+            // octant, rounded up to even
+            __m256i octant = _mm256_cvttps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(FOUR_OVER_PI)));
+            octant = _mm256_and_si256(_mm256_add_epi32(octant, _mm256_set1_epi32(1)), _mm256_set1_epi32(~1));
+            const Float y = _mm256_cvtepi32_ps(octant);
+            sinSign = _mm256_xor_ps(sinSign, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(octant, _mm256_set1_epi32(4)), 29)));
+            const Float cosSign = _mm256_castsi256_ps(
+                _mm256_slli_epi32(_mm256_andnot_si256(_mm256_sub_epi32(octant, _mm256_set1_epi32(2)), _mm256_set1_epi32(4)), 29));
+            const Float sinPolyMask = _mm256_castsi256_ps(
+                _mm256_cmpeq_epi32(_mm256_and_si256(octant, _mm256_set1_epi32(2)), _mm256_setzero_si256()));
+
+            x = _mm256_add_ps(x, _mm256_mul_ps(y, _mm256_set1_ps(DP1)));
+            x = _mm256_add_ps(x, _mm256_mul_ps(y, _mm256_set1_ps(DP2)));
+            x = _mm256_add_ps(x, _mm256_mul_ps(y, _mm256_set1_ps(DP3)));
+            const Float z = _mm256_mul_ps(x, x);
+
+            Float cosPoly = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(COS_P0), z), _mm256_set1_ps(COS_P1));
+            cosPoly = _mm256_add_ps(_mm256_mul_ps(cosPoly, z), _mm256_set1_ps(COS_P2));
+            cosPoly = _mm256_mul_ps(_mm256_mul_ps(cosPoly, z), z);
+            cosPoly = _mm256_add_ps(_mm256_sub_ps(cosPoly, _mm256_mul_ps(z, _mm256_set1_ps(0.5F))), _mm256_set1_ps(1.F));
+            Float sinPoly = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(SIN_P0), z), _mm256_set1_ps(SIN_P1));
+            sinPoly = _mm256_add_ps(_mm256_mul_ps(sinPoly, z), _mm256_set1_ps(SIN_P2));
+            sinPoly = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(sinPoly, z), x), x);
+
+            sine = _mm256_xor_ps(_mm256_blendv_ps(cosPoly, sinPoly, sinPolyMask), sinSign);
+            cosine = _mm256_xor_ps(_mm256_blendv_ps(sinPoly, cosPoly, sinPolyMask), cosSign);
+        }
+
+        inline bool inRange(const Float angle) noexcept {
+            const Float magnitude = _mm256_andnot_ps(_mm256_castsi256_ps(_mm256_set1_epi32(C_I32T(0x80000000U))), angle);
+            return _mm256_movemask_ps(_mm256_cmp_ps(magnitude, _mm256_set1_ps(REDUCTION_LIMIT), _CMP_LE_OQ)) == 0xFF;
+        }
+
+        inline Float load(const float *values) noexcept { return _mm256_load_ps(values); }
+        inline void store(float *values, const Float value) noexcept { _mm256_store_ps(values, value); }
+#elif defined(VULKRT_TRANSFORM_SSE)
+        constexpr std::size_t LANES = 4;
+        using Float = __m128;
+
+        inline Float select(const Float mask, const Float ifTrue, const Float ifFalse) noexcept {
+            return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+        }
+
+        inline void sincos(const Float angle, Float &sine, Float &cosine) noexcept {
+            const Float signMask = _mm_castsi128_ps(_mm_set1_epi32(C_I32T(0x80000000U)));
+            Float sinSign = _mm_and_ps(angle, signMask);
+            Float x = _mm_andnot_ps(signMask, angle);
+            __m128i octant = _mm_cvttps_epi32(_mm_mul_ps(x, _mm_set1_ps(FOUR_OVER_PI)));
+            octant = _mm_and_si128(_mm_add_epi32(octant, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+            const Float y = _mm_cvtepi32_ps(octant);
+            sinSign = _mm_xor_ps(sinSign, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(octant, _mm_set1_epi32(4)), 29)));
+            const Float cosSign = _mm_castsi128_ps(
+                _mm_slli_epi32(_mm_andnot_si128(_mm_sub_epi32(octant, _mm_set1_epi32(2)), _mm_set1_epi32(4)), 29));
+            const Float sinPolyMask = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(octant, _mm_set1_epi32(2)), _mm_setzero_si128()));
+
+            x = _mm_add_ps(x, _mm_mul_ps(y, _mm_set1_ps(DP1)));
+            x = _mm_add_ps(x, _mm_mul_ps(y, _mm_set1_ps(DP2)));
+            x = _mm_add_ps(x, _mm_mul_ps(y, _mm_set1_ps(DP3)));
+            const Float z = _mm_mul_ps(x, x);
+
+            Float cosPoly = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(COS_P0), z), _mm_set1_ps(COS_P1));
+            cosPoly = _mm_add_ps(_mm_mul_ps(cosPoly, z), _mm_set1_ps(COS_P2));
+            cosPoly = _mm_mul_ps(_mm_mul_ps(cosPoly, z), z);
+            cosPoly = _mm_add_ps(_mm_sub_ps(cosPoly, _mm_mul_ps(z, _mm_set1_ps(0.5F))), _mm_set1_ps(1.F));
+            Float sinPoly = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(SIN_P0), z), _mm_set1_ps(SIN_P1));
+            sinPoly = _mm_add_ps(_mm_mul_ps(sinPoly, z), _mm_set1_ps(SIN_P2));
+            sinPoly = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(sinPoly, z), x), x);
+
+            sine = _mm_xor_ps(select(sinPolyMask, sinPoly, cosPoly), sinSign);
+            cosine = _mm_xor_ps(select(sinPolyMask, cosPoly, sinPoly), cosSign);
+        }
+
+        inline bool inRange(const Float angle) noexcept {
+            const Float magnitude = _mm_andnot_ps(_mm_castsi128_ps(_mm_set1_epi32(C_I32T(0x80000000U))), angle);
+            return _mm_movemask_ps(_mm_cmple_ps(magnitude, _mm_set1_ps(REDUCTION_LIMIT))) == 0xF;
+        }
+
+        inline Float load(const float *values) noexcept { return _mm_load_ps(values); }
+        inline void store(float *values, const Float value) noexcept { _mm_store_ps(values, value); }
+#endif
+    }  // namespace
+
+    void TransformKernel::computeScalar(std::span<const glm::vec3> translations, std::span<const glm::vec3> rotations,
+                                        std::span<const glm::vec3> scales, glm::mat4 *modelMatrices,
+                                        glm::mat4 *normalMatrices) noexcept {
+        assert(rotations.size() == translations.size() && scales.size() == translations.size() && "component arrays differ in size");
+        for(std::size_t i = 0; i < translations.size(); ++i) {
+            modelMatrices[i] = TransformComponent::computeMat4(translations[i], rotations[i], scales[i]);
+            normalMatrices[i] = TransformComponent::computeNormalMatrix(rotations[i], scales[i]);
+        }
+    }
+
+    void TransformKernel::compute(std::span<const glm::vec3> translations, std::span<const glm::vec3> rotations,
+                                  std::span<const glm::vec3> scales, glm::mat4 *modelMatrices, glm::mat4 *normalMatrices) noexcept {
+        assert(rotations.size() == translations.size() && scales.size() == translations.size() && "component arrays differ in size");
+        const std::size_t size = translations.size();
+        std::size_t i = 0;
+#if defined(VULKRT_TRANSFORM_AVX2) || defined(VULKRT_TRANSFORM_SSE)
+        // per lane group: gather the angles per axis, evaluate sin/cos of all three axes, then assemble per object
+        alignas(32) float angles[3][LANES];   // NOLINT(*-avoid-c-arrays) x, y, z
+        alignas(32) float sines[3][LANES];    // NOLINT(*-avoid-c-arrays)
+        alignas(32) float cosines[3][LANES];  // NOLINT(*-avoid-c-arrays)
+        for(; i + LANES <= size; i += LANES) {
+            for(std::size_t lane = 0; lane < LANES; ++lane) {
+                const glm::vec3 &rotation = rotations[i + lane];
+                angles[0][lane] = rotation.x;
+                angles[1][lane] = rotation.y;
+                angles[2][lane] = rotation.z;
+            }
+            bool reduced = true;
+            for(std::size_t axis = 0; axis < 3; ++axis) {
+                const Float angle = load(angles[axis]);
+                reduced = reduced && inRange(angle);
+                Float sine;
+                Float cosine;
+                sincos(angle, sine, cosine);
+                store(sines[axis], sine);
+                store(cosines[axis], cosine);
+            }
+            for(std::size_t lane = 0; lane < LANES; ++lane) {
+                const std::size_t object = i + lane;
+                const Trig trig = reduced ? Trig{.c1 = cosines[1][lane],
+                                                 .s1 = sines[1][lane],
+                                                 .c2 = cosines[0][lane],
+                                                 .s2 = sines[0][lane],
+                                                 .c3 = cosines[2][lane],
+                                                 .s3 = sines[2][lane]}
+                                          : scalarTrig(rotations[object]);
+                assemble(translations[object], scales[object], trig, modelMatrices[object], normalMatrices[object]);
+            }
+        }
+#endif
+        for(; i < size; ++i) { assemble(translations[i], scales[i], scalarTrig(rotations[i]), modelMatrices[i], normalMatrices[i]); }
+    }
+
+    std::string_view TransformKernel::isa() noexcept {
+#if defined(VULKRT_TRANSFORM_AVX2)
+        return "AVX2";
+#elif defined(VULKRT_TRANSFORM_SSE)
+        return "SSE2";
+#else
+        return "scalar";
+#endif
+    }
+    DISABLE_WARNINGS_POP()
+
+}  // namespace lve
+   // NOLINTEND(*-include-cleaner)
@@ -4,13 +4,21 @@
 #include <internal_use_only/config.hpp>
 
 // NOLINTNEXTLINE(bugprone-exception-escape)
-int main() {
+int main(int argc, char *argv[]) {
     INIT_LOG()
     LINFO("{} {}v {}", vulkrt::cmake::project_name, vulkrt::cmake::project_version, vulkrt::cmake::git_sha);
     LINFO("{}", glfwGetVersionString());
-    lve::App app{};
     try {
-        app.run();
+        const auto config = lve::AppConfig::fromArgs(std::span{argv, C_ST(argc)}.subspan(1));
+        if(!config.tracePath.empty()) {
+            vnd::TraceProfiler::setThreadName("main");
+            vnd::TraceProfiler::setEnabled(true);
+        }
+        {
+            lve::App app{config};
+            app.run();
+        }
+        if(!config.tracePath.empty()) { (void)vnd::TraceProfiler::writeChromeTrace(config.tracePath); }
     } catch(const std::exception &e) {
         LERROR("{}", e.what());
         return EXIT_FAILURE;
@@ -0,0 +1,103 @@
+// NOLINTBEGIN(*-include-cleaner)
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+
+#include <vulkrt/SceneStore.hpp>
+
+namespace {
+    using lve::SceneStore;
+
+    SceneStore::id_t addObject(SceneStore &scene, const glm::vec3 &translation) {
+        auto object = lve::GameObject::createGameObject();
+        const auto id = object.get_id();
+        object.transform.translation = translation;
+        scene.insert(std::move(object));
+        return id;
+    }
+
+    glm::vec3 worldTranslation(const SceneStore &scene, SceneStore::id_t id) {
+        const glm::vec4 &column = scene.modelMatrices()[scene.indexOf(id)][3];
+        return {column.x, column.y, column.z};
+    }
+
+    bool near(const glm::vec3 &a, const glm::vec3 &b) {
+        static constexpr float EPSILON = 1e-5F;
+        return std::abs(a.x - b.x) < EPSILON && std::abs(a.y - b.y) < EPSILON && std::abs(a.z - b.z) < EPSILON;
+    }
+}  // namespace
+
+TEST_CASE("setParent rejects cycles", "[scene_store]") {
+    SceneStore scene;
+    const auto root = addObject(scene, {});
+    const auto child = addObject(scene, {});
+    const auto grandchild = addObject(scene, {});
+    REQUIRE(scene.setParent(child, root));
+    REQUIRE(scene.setParent(grandchild, child));
+
+    CHECK_FALSE(scene.setParent(root, root));
+    CHECK_FALSE(scene.setParent(root, child));
+    CHECK_FALSE(scene.setParent(root, grandchild));
+    CHECK(scene.parentOf(root) == SceneStore::NO_PARENT);
+    CHECK(scene.parentOf(child) == root);
+    CHECK(scene.parentOf(grandchild) == child);
+}
+
+TEST_CASE("erasing a parent turns its children into roots", "[scene_store]") {
+    SceneStore scene;
+    const auto parent = addObject(scene, {1.F, 0.F, 0.F});
+    const auto first = addObject(scene, {0.F, 2.F, 0.F});
+    const auto second = addObject(scene, {0.F, 0.F, 3.F});
+    REQUIRE(scene.setParent(first, parent));
+    REQUIRE(scene.setParent(second, parent));
+    scene.updateMatrices();
+    REQUIRE(near(worldTranslation(scene, first), {1.F, 2.F, 0.F}));
+
+    REQUIRE(scene.erase(parent));
+    scene.updateMatrices();
+
+    CHECK_FALSE(scene.contains(parent));
+    CHECK(scene.parentOf(first) == SceneStore::NO_PARENT);
+    CHECK(scene.parentOf(second) == SceneStore::NO_PARENT);
+    // the local transform is kept and now is the world transform
+    CHECK(near(worldTranslation(scene, first), {0.F, 2.F, 0.F}));
+    CHECK(near(worldTranslation(scene, second), {0.F, 0.F, 3.F}));
+}
+
+TEST_CASE("moving a parent updates the world matrices of its descendants", "[scene_store]") {
+    SceneStore scene;
+    const auto root = addObject(scene, {1.F, 0.F, 0.F});
+    const auto child = addObject(scene, {0.F, 2.F, 0.F});
+    const auto grandchild = addObject(scene, {0.F, 0.F, 3.F});
+    const auto unrelated = addObject(scene, {7.F, 0.F, 0.F});
+    REQUIRE(scene.setParent(child, root));
+    REQUIRE(scene.setParent(grandchild, child));
+    scene.updateMatrices();
+    REQUIRE(near(worldTranslation(scene, grandchild), {1.F, 2.F, 3.F}));
+
+    scene.setTranslation(root, {5.F, 0.F, 0.F});
+    CHECK(scene.updateMatrices() == 3);
+
+    CHECK(near(worldTranslation(scene, root), {5.F, 0.F, 0.F}));
+    CHECK(near(worldTranslation(scene, child), {5.F, 2.F, 0.F}));
+    CHECK(near(worldTranslation(scene, grandchild), {5.F, 2.F, 3.F}));
+    CHECK(near(worldTranslation(scene, unrelated), {7.F, 0.F, 0.F}));
+}
+
+TEST_CASE("recomputed matrices are stamped after the change that caused them", "[scene_store]") {
+    SceneStore scene;
+    const auto parent = addObject(scene, {});
+    const auto child = addObject(scene, {});
+    REQUIRE(scene.setParent(child, parent));
+    scene.updateMatrices();
+
+    scene.setTranslation(parent, {1.F, 0.F, 0.F});
+    const SceneStore::stamp_t previous = scene.stamp();
+    scene.updateMatrices();
+
+    // a consumer that uploaded at stamp() before updateMatrices() must see both matrices as changed since
+    CHECK(scene.transformStamp(scene.indexOf(parent)) > previous);
+    CHECK(scene.transformStamp(scene.indexOf(child)) > previous);
+    CHECK(scene.matricesStamp() >= scene.transformStamp(scene.indexOf(parent)));
+    CHECK(scene.matricesStamp() >= scene.transformStamp(scene.indexOf(child)));
+}
+// NOLINTEND(*-include-cleaner)